@@ -1,5 +1,8 @@
 #include <vector>
 #include <iostream>
+#include <utility>
+#include <memory>
+#include <limits>
 
 /**
  * @file main.cpp
@@ -9,7 +12,211 @@
 
 #include "simplex/simplex_inteiro.hpp"
 #include "simplex/simplex.hpp"
+#include "simplex/simplex_revisado.hpp"
 #include "util/preparador.hpp"
+#include "util/matriz.hpp"
+#include "util/matriz_esparsa.hpp"
+#include "util/configuracao.hpp"
+#include "util/presolve.hpp"
+#include "util/escalonamento.hpp"
+
+/**
+ * @brief Verifica se alguma variável foi fixada pelo presolve em um valor fracionário, que é imposto pelas restrições e torna o problema inteiro inviável
+ * 
+ * @param reducao O resultado do presolve
+ * @return true Se todas as variáveis fixadas têm valor inteiro
+ * @return false Caso contrário, após informar a variável
+ */
+
+bool verificaFixacoesInteiras(const ReducaoPresolve &reducao)
+{
+    for (auto &operacao : reducao.operacoes)
+    {
+        if (operacao.tipo == TipoReducao::FIXA_COLUNA && operacao.coluna < reducao.numVarsOriginal && !eInteiro(operacao.valor))
+        {
+            std::cout << "O presolve fixou x" << operacao.coluna + 1 << " em " << operacao.valor
+                        << ", valor imposto pelas restrições. O problema inteiro não possui solução.\n";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Aplica o presolve e informa o tamanho do problema reduzido. Se o presolve resolve o problema, imprime a solução
+ * e responde também se as variáveis devem ser inteiras, pois não há problema reduzido para o Branch and Bound
+ * 
+ * @param a A matriz de coeficientes do problema, substituída pela reduzida
+ * @param b O vetor de soluções do problema
+ * @param c O vetor de coeficientes da função objetivo
+ * @param numVars O número de variáveis na forma canônica
+ * @param limites O limite superior de cada variável da forma canônica
+ * @param tipoProblema Indica se o problema é de maximização ou minimização
+ * @param configuracao As opções de execução fornecidas pela linha de comando
+ * @param reducao Recebe o resultado do presolve, utilizado no postsolve
+ * @return true Se o problema reduzido deve ser resolvido
+ * @return false Se o presolve provou que o problema não possui solução ou já o resolveu, inclusive o problema inteiro
+ */
+
+bool aplicaPresolve(MatrizEsparsa &a, std::vector<double> &b, std::vector<double> &c, int &numVars, std::vector<double> &limites, bool tipoProblema,
+                    const Configuracao &configuracao, ReducaoPresolve &reducao)
+{
+    /* Limites implícitos e restrições com uma variável só viram limites das variáveis no tableau, que os trata no teste da razão */
+
+    reducao = realizaPresolve(a, b, c, numVars, limites, tipoProblema, configuracao.metodo == MetodoSimplex::TABLEAU);
+
+    if (!reducao.aplicado)
+    {
+        std::cout << "Presolve não aplicado: cada coluna de folga deve ter um único coeficiente 1 ou -1 e custo nulo.\n\n";
+        return true;
+    }
+
+    if (reducao.semSolucao)
+    {
+        std::cout << "O presolve provou que o problema não possui solução.\n";
+        return false;
+    }
+
+    std::cout << "Presolve: " << a.getLinhas() << " de " << reducao.linhasOriginais << " restrições e " << numVars << " de "
+                << reducao.numVarsOriginal << " variáveis de decisão mantidas.\n\n";
+
+    if (a.getColunas() > 0)
+        return true;
+
+    /* Todas as variáveis foram fixadas em valores impostos pelas restrições ou em limites inteiros ótimos, então não há o que resolver */
+
+    std::vector<int> basicasOriginais;
+    std::vector<double> solucao = realizaPostsolve(reducao, {}, {}, basicasOriginais);
+
+    std::cout << "O presolve resolveu o problema.\n\nSolução do problema original: ";
+
+    for (int j = 0 ; j < reducao.numVarsOriginal ; j++)
+        std::cout << solucao[j] << " ";
+
+    std::cout << std::endl << "Solução ótima: " << (reducao.constanteObjetivo != 0 ? -reducao.constanteObjetivo : 0) << std::endl;
+
+    bool eProblemaInteiro = false;
+
+    std::cout << std::endl << "Deseja que as variáveis sejam inteiras? Digite 1 para sim, 0 para não.\n";
+    std::cin >> eProblemaInteiro;
+
+    if (!eProblemaInteiro || !verificaFixacoesInteiras(reducao))
+        return false;
+
+    for (int j = 0 ; j < reducao.numVarsOriginal ; j++)
+    {
+        if (!eInteiro(solucao[j])) // Valor de uma folga implícita, que o Branch and Bound teria que ramificar sem colunas no problema reduzido
+        {
+            std::cout << "A solução do presolve não é inteira em x" << j + 1 << ", e o problema reduzido não tem variáveis para o Branch and Bound. "
+                        << "Resolva o problema inteiro sem a opção --presolve.\n";
+            return false;
+        }
+    }
+
+    std::cout << "O problema já possui solução inteira.\nSolução inteira no problema original: ";
+
+    for (int j = 0 ; j < reducao.numVarsOriginal ; j++)
+        std::cout << solucao[j] << " ";
+
+    std::cout << std::endl;
+
+    return false;
+}
+
+/**
+ * @brief Aplica o escalonamento e informa a razão entre os coeficientes antes e depois dele
+ * 
+ * @param a A matriz de coeficientes do problema, substituída pela escalonada
+ * @param b O vetor de soluções do problema
+ * @param c O vetor de coeficientes da função objetivo
+ * @param numVars O número de variáveis na forma canônica
+ * @param limites O limite superior de cada variável da forma canônica
+ * @param configuracao As opções de execução fornecidas pela linha de comando
+ * @return FatoresEscala Os fatores aplicados, utilizados no desescalonamento da solução
+ */
+
+FatoresEscala aplicaEscalonamento(MatrizEsparsa &a, std::vector<double> &b, std::vector<double> &c, int numVars, std::vector<double> &limites,
+                                    const Configuracao &configuracao)
+{
+    FatoresEscala fatores = realizaEscalonamento(a, b, c, numVars, limites, configuracao.escalonamento);
+
+    if (fatores.aplicado)
+        std::cout << "Escalonamento: razão entre o maior e o menor coeficiente de " << fatores.razaoOriginal << " para " << fatores.razaoFinal << ".\n\n";
+    else
+        std::cout << "Escalonamento não aplicado: os coeficientes já estão bem escalonados.\n\n";
+
+    return fatores;
+}
+
+/**
+ * @brief Imprime a solução e a base do problema original, obtidas pelo postsolve a partir do problema reduzido resolvido
+ * 
+ * @param simplex O problema reduzido já resolvido
+ * @param reducao O resultado do presolve
+ */
+
+void imprimePostsolve(Simplex &simplex, const ReducaoPresolve &reducao)
+{
+    std::vector<double> valores;
+    std::vector<int> basicas;
+    std::vector<int> basicasOriginais;
+
+    if (!simplex.retornaSolucao(valores, basicas))
+        return;
+
+    std::vector<double> solucao = realizaPostsolve(reducao, valores, basicas, basicasOriginais);
+
+    std::cout << std::endl << "Variáveis básicas no problema original: " << std::endl;
+    std::cout << "====================================================" << std::endl;
+
+    for (int j : basicasOriginais)
+        std::cout << "x" << j + 1 << " " << solucao[j] << " " << std::endl;
+
+    std::cout << std::endl << "Solução do problema original: ";
+
+    for (int j = 0 ; j < reducao.numVarsOriginal ; j++)
+        std::cout << solucao[j] << " ";
+
+    std::cout << std::endl;
+}
+
+/**
+ * @brief Resolve o problema inteiro a partir do problema resolvido. Com o presolve, verifica antes se alguma variável foi fixada
+ * em um valor fracionário, que é imposto pelas restrições e torna o problema inteiro inviável, e leva a solução inteira ao problema original.
+ * 
+ * @param simplex O problema já resolvido
+ * @param numVars O número de variáveis na forma canônica do problema resolvido
+ * @param restricoes As restrições do problema resolvido, sem as variáveis artificiais, usadas na separação dos cortes de cobertura e de clique
+ * @param b O vetor de soluções do problema resolvido
+ * @param c O vetor de coeficientes da função objetivo do problema resolvido, usado pelas heurísticas primais
+ * @param reducao O resultado do presolve
+ * @param configuracao As opções de execução fornecidas pela linha de comando
+ */
+
+void resolveProblemaInteiro(Simplex &simplex, int numVars, const MatrizEsparsa &restricoes, const std::vector<double> &b, const std::vector<double> &c,
+                            const ReducaoPresolve &reducao, const Configuracao &configuracao)
+{
+    if (reducao.aplicado && !verificaFixacoesInteiras(reducao))
+        return;
+
+    simplex.garanteTableauFinal();
+
+    std::vector<double> solucaoInteira = iniciaProblemaInteiro(simplex, numVars, restricoes, b, c, configuracao); // Começa a resolução do problema inteiro.
+
+    if (!reducao.aplicado || solucaoInteira.empty())
+        return;
+
+    std::vector<int> basicasOriginais;
+    std::vector<double> solucao = realizaPostsolve(reducao, solucaoInteira, {}, basicasOriginais);
+
+    std::cout << "Solução inteira no problema original: ";
+
+    for (int j = 0 ; j < reducao.numVarsOriginal ; j++)
+        std::cout << solucao[j] << " ";
+
+    std::cout << std::endl;
+}
 
 /**
  * @brief Inicializa o problema conforme as entradas do usuário
@@ -21,46 +228,178 @@
  * @param tamanhoColunaA O número de coeficientes no problema
  * @param numVars O número de variáveis na forma canônica
  * @param tipoProblema Indica se o problema é de maximização ou minimização
+ * @param limites O limite superior de cada variável da forma canônica, infinito se não houver
+ * @param configuracao As opções de execução fornecidas pela linha de comando
  */
 
-void inicializaProblemaOriginal(std::vector<std::vector<double>> a, std::vector<double> b, std::vector<double> c, int tamanhoLinhaA, int tamanhoColunaA, int numVars, bool tipoProblema)
+void inicializaProblemaOriginal(Matriz a, std::vector<double> b, std::vector<double> c, int tamanhoLinhaA, int tamanhoColunaA, int numVars, bool tipoProblema,
+                                std::vector<double> limites, const Configuracao &configuracao)
 {
     /*
-    * Ao resolvermos o Simplex, iremos perder o problema original. Caso o usuário deseje arredondar para variáveis inteiras,
-    * é necessário uma cópia do problema original para começarmos o método Branch and Bound.
+    * Caso o usuário deseje arredondar para variáveis inteiras, o Branch and Bound parte do tableau final do problema resolvido,
+    * então não é necessário copiar o problema original.
     */
 
-    std::vector<std::vector<double>> aOriginal;
-    std::vector<double> bOriginal;
-    std::vector<double> cOriginal;
-    
     bool eProblemaInteiro = false; // Supõe, inicialmente, que o usuário não deseja arredondar as variáveis.
+    ReducaoPresolve reducao; // Resultado do presolve, se aplicado
+    FatoresEscala fatores; // Fatores do escalonamento, se aplicado
 
+    if (configuracao.presolve || configuracao.escalonamento != MetodoEscalonamento::NENHUM)
+    {
+        MatrizEsparsa esparsa(a); // O presolve e o escalonamento trabalham sobre os elementos não nulos
+
+        if (configuracao.presolve && !aplicaPresolve(esparsa, b, c, numVars, limites, tipoProblema, configuracao, reducao))
+            return;
+
+        if (configuracao.escalonamento != MetodoEscalonamento::NENHUM)
+            fatores = aplicaEscalonamento(esparsa, b, c, numVars, limites, configuracao);
+
+        if (reducao.aplicado || fatores.aplicado)
+        {
+            tamanhoLinhaA = esparsa.getLinhas();
+            tamanhoColunaA = esparsa.getColunas();
+            a = esparsa.paraDensa(tamanhoLinhaA); // Reserva colunas para as variáveis artificiais
+        }
+    }
+
+    MatrizEsparsa restricoes(a); // Cópia das restrições sem as artificiais, para a detecção da estrutura binária no Branch and Bound
     PreparacaoSimplex preparador = retornaPreparacaoSimplex(a, tamanhoLinhaA, tamanhoColunaA, numVars); // Contém a preparação para o método de duas fases, se necessário.
 
-    /* Copia o problema original para as variáveis referência */
+    adicionaVariaveisArtificiais(a, c, tamanhoColunaA, tamanhoLinhaA, preparador); // Adiciona as variáveis artificiais, se necessário.
+
+    std::unique_ptr<Simplex> simplex; // Instância do Simplex do PPL original, conforme o método escolhido
 
-    aOriginal = realizaCopiaProfunda(a);
-    bOriginal = realizaCopiaProfunda(b);
-    cOriginal = realizaCopiaProfunda(c);
+    if (configuracao.metodo == MetodoSimplex::REVISADO)
+        simplex.reset(new SimplexRevisado(std::move(a), b, c, tipoProblema, preparador.eDuasFases, preparador.numVarArtificiais, numVars,
+                                            configuracao.frequenciaRefatoracao));
+    else
+        simplex.reset(new Simplex(std::move(a), b, c, tipoProblema, preparador.eDuasFases, preparador.numVarArtificiais, numVars));
 
-    adicionaVariaveisArtificiais(a, c, tamanhoColunaA, tamanhoLinhaA, preparador); // Já que copiamos o problema original, pode-se adicionar as variáveis artificiais, se necessário.
+    simplex->defineLimitesSuperiores(limites); // Limites nas variáveis, tratados no teste da razão em vez de restrições explícitas
+    simplex->definePrecificacao(configuracao.precificacao);
+    simplex->defineTratamentoDegeneracao(configuracao.razao == RegraRazao::HARRIS, configuracao.limiteSemProgresso, configuracao.perturbacao);
 
-    Simplex simplex(a, b, c, tipoProblema, preparador.eDuasFases, preparador.numVarArtificiais, numVars); // Cria a instância do Simplex do PPL original.
-    simplex.aplicaSimplex(preparador.ondeAdicionar); // Resolve o problema
+    simplex->defineConstanteObjetivo(reducao.constanteObjetivo); // Contribuição das variáveis fixadas pelo presolve
+
+    if (fatores.aplicado)
+        simplex->defineEscalaColunas(fatores.colunas); // As soluções são impressas e ramificadas na escala fornecida
+
+    simplex->aplicaSimplex(preparador.ondeAdicionar); // Resolve o problema
+
+    if (reducao.aplicado)
+        imprimePostsolve(*simplex, reducao);
 
     std::cout << std::endl << "Deseja que as variáveis sejam inteiras? Digite 1 para sim, 0 para não.\n"; 
     std::cin >> eProblemaInteiro;
 
     if (eProblemaInteiro)
-        iniciaProblemaInteiro(simplex, aOriginal, bOriginal, cOriginal, numVars); // Começa a resolução do problema inteiro.
+        resolveProblemaInteiro(*simplex, numVars, restricoes, b, c, reducao, configuracao);
+}
+
+/**
+ * @brief Inicializa o problema lido no formato esparso. O Simplex revisado trabalha diretamente com a matriz esparsa,
+ * e o tradicional recebe a matriz densa equivalente.
+ * 
+ * @param a A matriz de coeficientes do problema, no formato esparso
+ * @param b O vetor de soluções do problema
+ * @param c O vetor de coeficientes da função objetivo
+ * @param tamanhoLinhaA O número de restrições no problema
+ * @param tamanhoColunaA O número de coeficientes no problema
+ * @param numVars O número de variáveis na forma canônica
+ * @param tipoProblema Indica se o problema é de maximização ou minimização
+ * @param limites O limite superior de cada variável da forma canônica, infinito se não houver
+ * @param configuracao As opções de execução fornecidas pela linha de comando
+ */
+
+void inicializaProblemaOriginal(MatrizEsparsa a, std::vector<double> b, std::vector<double> c, int tamanhoLinhaA, int tamanhoColunaA, int numVars, bool tipoProblema,
+                                std::vector<double> limites, const Configuracao &configuracao)
+{
+    bool eProblemaInteiro = false;
+    ReducaoPresolve reducao;
+    FatoresEscala fatores;
+
+    if (configuracao.presolve)
+    {
+        if (!aplicaPresolve(a, b, c, numVars, limites, tipoProblema, configuracao, reducao))
+            return;
+
+        tamanhoLinhaA = a.getLinhas();
+        tamanhoColunaA = a.getColunas();
+    }
+
+    if (configuracao.escalonamento != MetodoEscalonamento::NENHUM)
+        fatores = aplicaEscalonamento(a, b, c, numVars, limites, configuracao);
+
+    MatrizEsparsa restricoes(a);
+    PreparacaoSimplex preparador = retornaPreparacaoSimplex(a, tamanhoLinhaA, tamanhoColunaA, numVars);
+
+    adicionaVariaveisArtificiais(a, c, tamanhoColunaA, preparador);
+
+    std::unique_ptr<Simplex> simplex;
+
+    if (configuracao.metodo == MetodoSimplex::REVISADO)
+        simplex.reset(new SimplexRevisado(std::move(a), b, c, tipoProblema, preparador.eDuasFases, preparador.numVarArtificiais, numVars,
+                                            configuracao.frequenciaRefatoracao));
+    else
+        simplex.reset(new Simplex(a.paraDensa(), b, c, tipoProblema, preparador.eDuasFases, preparador.numVarArtificiais, numVars));
+
+    simplex->defineLimitesSuperiores(limites);
+    simplex->definePrecificacao(configuracao.precificacao);
+    simplex->defineTratamentoDegeneracao(configuracao.razao == RegraRazao::HARRIS, configuracao.limiteSemProgresso, configuracao.perturbacao);
+
+    simplex->defineConstanteObjetivo(reducao.constanteObjetivo);
+
+    if (fatores.aplicado)
+        simplex->defineEscalaColunas(fatores.colunas);
+
+    simplex->aplicaSimplex(preparador.ondeAdicionar);
+
+    if (reducao.aplicado)
+        imprimePostsolve(*simplex, reducao);
+
+    std::cout << std::endl << "Deseja que as variáveis sejam inteiras? Digite 1 para sim, 0 para não.\n"; 
+    std::cin >> eProblemaInteiro;
+
+    if (eProblemaInteiro)
+        resolveProblemaInteiro(*simplex, numVars, restricoes, b, c, reducao, configuracao);
+}
+
+/**
+ * @brief Lê os coeficientes não nulos das restrições no formato esparso: a quantidade, seguida de uma tripla
+ * "restrição coluna valor" por coeficiente, com índices começando em 1.
+ * 
+ * @param tamanhoLinhaA O número de restrições no problema
+ * @param tamanhoColunaA O número de coeficientes no problema
+ * @return MatrizEsparsa A matriz de coeficientes
+ */
+
+MatrizEsparsa leMatrizEsparsa(int tamanhoLinhaA, int tamanhoColunaA)
+{
+    int numNaoNulos = 0;
+
+    std::cout << "Digite o número de coeficientes não nulos nas restrições:" << std::endl;
+    std::cin >> numNaoNulos;
+
+    std::vector<ElementoEsparso> elementos(numNaoNulos);
+
+    std::cout << "Digite cada coeficiente não nulo no formato: restrição coluna valor" << std::endl;
+
+    for (int k = 0 ; k < numNaoNulos ; k++)
+    {
+        std::cin >> elementos[k].linha >> elementos[k].coluna >> elementos[k].valor;
+        elementos[k].linha--;
+        elementos[k].coluna--;
+    }
+
+    return MatrizEsparsa(tamanhoLinhaA, tamanhoColunaA, elementos);
 }
 
 /**
  * @brief Realiza a interação com o usuário e a recepção dos dados do problema original.
  * 
+ * @param configuracao As opções de execução fornecidas pela linha de comando
  */
-void recebeEntradaUsuario()
+void recebeEntradaUsuario(const Configuracao &configuracao)
 {
     int tamanhoColunaA; 
     int tamanhoLinhaA;
@@ -79,17 +418,26 @@ void recebeEntradaUsuario()
     std::cout << "Digite o número de restrições do problema:" << std::endl;
     std::cin >> tamanhoLinhaA;
 
-    std::vector <std::vector<double>> a(tamanhoLinhaA, std::vector<double>(tamanhoColunaA, 0));
+    Matriz a;
+    MatrizEsparsa aEsparsa;
     std::vector<double> b(tamanhoLinhaA, 0);
     std::vector<double> c(tamanhoColunaA, 0);
 
-    for (int i = 0 ; i < tamanhoLinhaA ; i++)
-    {    
-        std::cout << "Digite os coeficientes da restrição " + std::to_string(i + 1) << std::endl;
+    if (configuracao.entrada == FormatoEntrada::ESPARSA)
+        aEsparsa = leMatrizEsparsa(tamanhoLinhaA, tamanhoColunaA);
+
+    else
+    {
+        a = Matriz(tamanhoLinhaA, tamanhoColunaA, tamanhoLinhaA); // Reserva colunas para as variáveis artificiais
 
-        for (int j = 0 ; j < tamanhoColunaA ; j++)
-            std::cin >> a[i][j];
-    }    
+        for (int i = 0 ; i < tamanhoLinhaA ; i++)
+        {    
+            std::cout << "Digite os coeficientes da restrição " + std::to_string(i + 1) << std::endl;
+
+            for (int j = 0 ; j < tamanhoColunaA ; j++)
+                std::cin >> a[i][j];
+        }    
+    }
 
     std::cout << "Digite os valores do vetor B:\n";
     for (int i = 0 ; i < tamanhoLinhaA ; i++)
@@ -99,12 +447,32 @@ void recebeEntradaUsuario()
     for (int i = 0 ; i < tamanhoColunaA ; i++)
         std::cin >> c[i];    
 
-    inicializaProblemaOriginal(a, b, c, tamanhoLinhaA, tamanhoColunaA, numVars, tipoProblema);
+    std::vector<double> limites(numVars, std::numeric_limits<double>::infinity()); // Sem limites superiores, a menos que sejam fornecidos
+
+    if (configuracao.leLimites)
+    {
+        std::cout << "Digite o limite superior de cada variável de decisão (negativo se não houver):\n";
+
+        for (int j = 0 ; j < numVars ; j++)
+        {
+            std::cin >> limites[j];
+
+            if (limites[j] < 0)
+                limites[j] = std::numeric_limits<double>::infinity();
+        }
+    }
+
+    if (configuracao.entrada == FormatoEntrada::ESPARSA)
+        inicializaProblemaOriginal(std::move(aEsparsa), b, c, tamanhoLinhaA, tamanhoColunaA, numVars, tipoProblema, limites, configuracao);
+    else
+        inicializaProblemaOriginal(std::move(a), b, c, tamanhoLinhaA, tamanhoColunaA, numVars, tipoProblema, limites, configuracao);
 }
 
-int main()
+int main(int argc, char **argv)
 {
-    recebeEntradaUsuario(); 
+    Configuracao configuracao = leConfiguracao(argc, argv);
+
+    recebeEntradaUsuario(configuracao); 
     
     return 0;
 }
\ No newline at end of file
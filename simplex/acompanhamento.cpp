@@ -0,0 +1,178 @@
+#include <iostream>
+#include <sstream>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+
+#include "acompanhamento.hpp"
+
+static const double VALOR_MINIMO_GAP = 1e-10; // Menor denominador do gap relativo, para incumbentes de valor nulo
+
+/**
+ * @brief Calcula o gap relativo entre o melhor limite e a incumbente, em relação ao valor da incumbente
+ *
+ */
+
+static double calculaGapRelativo(double limite, double valorIncumbente)
+{
+    return std::max(limite - valorIncumbente, 0.0) / std::max(std::fabs(valorIncumbente), VALOR_MINIMO_GAP);
+}
+
+Acompanhamento::Acompanhamento() : numParticoes(0), nosResolvidos(0), motivo(static_cast<int>(MotivoParada::NENHUM)), proximaImpressao(0),
+                                   limiteNos(0), limiteTempo(0), gapAbsoluto(0), gapRelativo(0), limiteSolucoes(0), intervaloProgresso(0),
+                                   maximizacao(true)
+{
+
+}
+
+void Acompanhamento::inicia(const Configuracao &configuracao, int numThreads, bool maximizacao)
+{
+    numParticoes = std::max(numThreads, 1);
+    particoes.reset(new Particao[numParticoes]);
+
+    nosResolvidos = 0;
+    motivo = static_cast<int>(MotivoParada::NENHUM);
+    limiteNos = configuracao.limiteNos;
+    limiteTempo = configuracao.limiteTempo;
+    gapAbsoluto = configuracao.gapAbsoluto;
+    gapRelativo = configuracao.gapRelativo;
+    limiteSolucoes = configuracao.limiteSolucoes;
+    intervaloProgresso = configuracao.intervaloProgresso;
+    proximaImpressao = std::llround(intervaloProgresso * 1000);
+    this->maximizacao = maximizacao;
+    inicio = std::chrono::steady_clock::now();
+}
+
+void Acompanhamento::adicionaNo(int id, double limite)
+{
+    Particao &particao = particoes[id % numParticoes];
+    std::lock_guard<std::mutex> trava(particao.trava);
+
+    particao.limites.insert(limite);
+}
+
+void Acompanhamento::encerraNo(int id, double limite)
+{
+    Particao &particao = particoes[id % numParticoes];
+
+    {
+        std::lock_guard<std::mutex> trava(particao.trava);
+        auto it = particao.limites.find(limite); // O valor é o mesmo que foi registrado, então a comparação exata o encontra
+
+        if (it != particao.limites.end())
+            particao.limites.erase(it);
+    }
+
+    nosResolvidos.fetch_add(1, std::memory_order_relaxed);
+}
+
+double Acompanhamento::melhorLimite(double valorIncumbente)
+{
+    double limite = -std::numeric_limits<double>::infinity();
+    bool haAbertos = false;
+
+    for (int p = 0 ; p < numParticoes ; p++)
+    {
+        std::lock_guard<std::mutex> trava(particoes[p].trava);
+
+        if (!particoes[p].limites.empty())
+        {
+            limite = std::max(limite, *particoes[p].limites.rbegin());
+            haAbertos = true;
+        }
+    }
+
+    if (!haAbertos) // A árvore acabou, e a incumbente é ótima
+        return valorIncumbente;
+
+    return std::max(limite, valorIncumbente); // Um nó aberto com limite abaixo da incumbente será descartado
+}
+
+bool Acompanhamento::deveParar(const Incumbente &incumbente, int nosAbertos)
+{
+    if (getMotivo() != MotivoParada::NENHUM)
+        return true;
+
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    double valorIncumbente = incumbente.getValor();
+    bool temIncumbente = valorIncumbente != -std::numeric_limits<double>::infinity();
+    MotivoParada atendido = MotivoParada::NENHUM;
+
+    if (limiteNos > 0 && getNosResolvidos() >= limiteNos)
+        atendido = MotivoParada::NOS;
+
+    else if (limiteTempo > 0 && segundos >= limiteTempo)
+        atendido = MotivoParada::TEMPO;
+
+    else if (limiteSolucoes > 0 && incumbente.getNumSolucoes() >= limiteSolucoes) // Conta apenas as melhoras estritas, pois um empate não substitui a incumbente
+        atendido = MotivoParada::SOLUCOES;
+
+    else if ((gapAbsoluto > 0 || gapRelativo > 0) && temIncumbente) // O melhor limite trava as partições, então só é calculado se há um gap a atingir
+    {
+        double limite = melhorLimite(valorIncumbente);
+
+        if ((gapAbsoluto > 0 && limite - valorIncumbente <= gapAbsoluto) || (gapRelativo > 0 && calculaGapRelativo(limite, valorIncumbente) <= gapRelativo))
+            atendido = MotivoParada::GAP;
+    }
+
+    long long milissegundos = std::llround(segundos * 1000);
+    long long prevista = proximaImpressao.load(std::memory_order_relaxed);
+
+    /* Apenas a thread que adianta a próxima impressão imprime a linha */
+
+    if (intervaloProgresso > 0 && milissegundos >= prevista &&
+        proximaImpressao.compare_exchange_strong(prevista, milissegundos + std::llround(intervaloProgresso * 1000), std::memory_order_relaxed))
+    {
+        std::ostringstream linha; // A linha é montada antes, para não se misturar com a de outra thread
+        double limite = melhorLimite(valorIncumbente);
+
+        linha << "Progresso: " << getNosResolvidos() << " nós resolvidos, " << nosAbertos << " abertos, incumbente ";
+
+        if (temIncumbente)
+            linha << valorExibido(valorIncumbente) << ", limite " << valorExibido(limite) << ", gap " << 100 * calculaGapRelativo(limite, valorIncumbente) << "%";
+        else
+            linha << "-, limite " << valorExibido(limite) << ", gap -";
+
+        linha << ", " << segundos << " s.\n";
+
+        std::cout << linha.str() << std::flush;
+    }
+
+    if (atendido == MotivoParada::NENHUM)
+        return false;
+
+    int esperado = static_cast<int>(MotivoParada::NENHUM); // Se outra thread registrou um critério antes, o dela é mantido
+
+    motivo.compare_exchange_strong(esperado, static_cast<int>(atendido), std::memory_order_acq_rel);
+
+    return true;
+}
+
+void Acompanhamento::imprimeResumo(const Incumbente &incumbente)
+{
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    MotivoParada parada = getMotivo();
+
+    if (parada == MotivoParada::NENHUM)
+    {
+        std::cout << "Branch and Bound concluído: " << getNosResolvidos() << " nós resolvidos em " << segundos << " s.\n";
+        return;
+    }
+
+    const char *criterio = parada == MotivoParada::NOS ? "pelo limite de nós" : parada == MotivoParada::TEMPO ? "pelo limite de tempo" :
+                           parada == MotivoParada::GAP ? "pelo gap" : "pelo limite de soluções";
+
+    std::cout << "Branch and Bound interrompido " << criterio << " após " << getNosResolvidos() << " nós resolvidos em " << segundos << " s.\n";
+
+    double valorIncumbente = incumbente.getValor();
+    double limite = melhorLimite(valorIncumbente);
+
+    if (valorIncumbente == -std::numeric_limits<double>::infinity())
+    {
+        std::cout << "Nenhuma solução inteira encontrada. Melhor limite: " << valorExibido(limite) << ".\n";
+        return;
+    }
+
+    std::cout << "Melhor limite: " << valorExibido(limite) << ", gap: " << 100 * calculaGapRelativo(limite, valorIncumbente)
+        << "%. A solução abaixo é a melhor encontrada, sem prova de otimalidade.\n";
+}
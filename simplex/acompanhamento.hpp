@@ -0,0 +1,142 @@
+#ifndef ACOMPANHAMENTO_H
+#define ACOMPANHAMENTO_H
+
+/**
+ * @file acompanhamento.hpp
+ * @brief Arquivo contendo a classe Acompanhamento, que mede o progresso do Branch and Bound e verifica os critérios de parada.
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+
+#include "incumbente.hpp"
+#include "../util/configuracao.hpp"
+
+/**
+ * @brief Critério que interrompeu o Branch and Bound antes do fim da árvore.
+ *
+ */
+
+enum class MotivoParada
+{
+    NENHUM, // A árvore foi percorrida até o fim
+    NOS, // Limite de nós resolvidos
+    TEMPO, // Limite de tempo
+    GAP, // Gap absoluto ou relativo entre o melhor limite e a incumbente
+    SOLUCOES // Limite de soluções que melhoraram a incumbente
+};
+
+/**
+ * @brief Progresso do Branch and Bound, compartilhado entre as threads: os nós resolvidos, o melhor limite dos nós abertos e o tempo.
+ *
+ * O limite de um nó aberto é o valor da relaxação do pai. Os limites ficam em partições, escolhidas pelo identificador do nó, cada uma com
+ * o seu mutex, então a thread que cria um nó e a que o encerra travam a mesma partição, e threads diferentes raramente a disputam.
+ * Os filhos são registrados antes do encerramento do pai, então o melhor limite nunca fica abaixo do ótimo da árvore restante.
+ * Cada thread verifica os critérios antes de resolver um nó, e a primeira que encontra um critério atendido o registra. As demais
+ * param ao verificar, e os nós ainda abertos são abandonados com os seus limites, que continuam no melhor limite final.
+ * A linha de progresso é impressa pela thread que primeiro nota que o intervalo passou.
+ */
+
+class Acompanhamento
+{
+    private:
+        typedef struct
+        {
+            std::mutex trava; // Mutex da partição
+            std::multiset<double> limites; // Limites dos nós abertos da partição, no objetivo interno
+        } Particao;
+
+        std::unique_ptr<Particao[]> particoes; // As partições dos limites dos nós abertos
+        int numParticoes; // Número de partições
+        std::atomic<long long> nosResolvidos; // Nós retirados e encerrados, resolvidos ou descartados pelo limite do pai
+        std::atomic<int> motivo; // O MotivoParada registrado, NENHUM enquanto a busca continua
+        std::atomic<long long> proximaImpressao; // Milissegundos, desde o início, em que a próxima linha de progresso é impressa
+        std::chrono::steady_clock::time_point inicio; // Início do Branch and Bound
+        long long limiteNos; // Nós resolvidos até a parada, 0 sem limite
+        double limiteTempo; // Segundos até a parada, 0 sem limite
+        double gapAbsoluto; // Diferença entre o melhor limite e a incumbente que encerra a busca, 0 desativa
+        double gapRelativo; // Diferença relativa ao valor da incumbente que encerra a busca, 0 desativa
+        int limiteSolucoes; // Soluções que melhoraram a incumbente até a parada, 0 sem limite
+        double intervaloProgresso; // Segundos entre duas linhas de progresso, 0 desativa
+        bool maximizacao; // Tipo do problema fornecido, para exibir os valores no objetivo dele
+
+        /**
+         * @brief Converte um valor do objetivo interno para o objetivo do problema fornecido
+         *
+         */
+
+        double valorExibido(double valor) const { return !maximizacao && valor != 0 ? -valor : valor; }
+
+    public:
+        Acompanhamento();
+
+        Acompanhamento(const Acompanhamento &) = delete;
+
+        Acompanhamento &operator=(const Acompanhamento &) = delete;
+
+        /**
+         * @brief Reinicia a contagem e o relógio e lê os critérios de parada
+         *
+         * @param configuracao As opções de execução, com os limites e o intervalo de progresso
+         * @param numThreads Número de threads do Branch and Bound, que define o número de partições
+         * @param maximizacao true se o problema fornecido é de maximização
+         */
+
+        void inicia(const Configuracao &configuracao, int numThreads, bool maximizacao);
+
+        /**
+         * @brief Registra um nó aberto
+         *
+         * @param id O identificador do nó
+         * @param limite O valor da relaxação do pai, no objetivo interno
+         */
+
+        void adicionaNo(int id, double limite);
+
+        /**
+         * @brief Retira um nó encerrado, com os mesmos valores do registro, e o conta como resolvido
+         *
+         * @param id O identificador do nó
+         * @param limite O valor da relaxação do pai, no objetivo interno
+         */
+
+        void encerraNo(int id, double limite);
+
+        /**
+         * @brief Retorna o melhor limite da árvore: o maior limite dos nós abertos, ou a incumbente se não há nó aberto
+         *
+         * @param valorIncumbente O valor da incumbente, no objetivo interno
+         * @return double O limite, no objetivo interno
+         */
+
+        double melhorLimite(double valorIncumbente);
+
+        /**
+         * @brief Verifica os critérios de parada e imprime a linha de progresso se o intervalo passou
+         *
+         * @param incumbente A solução incumbente
+         * @param nosAbertos Nós criados e ainda não encerrados
+         * @return true Se a busca deve parar, por este ou por um critério já registrado
+         * @return false Se a busca continua
+         */
+
+        bool deveParar(const Incumbente &incumbente, int nosAbertos);
+
+        MotivoParada getMotivo() const { return static_cast<MotivoParada>(motivo.load(std::memory_order_acquire)); }
+
+        long long getNosResolvidos() const { return nosResolvidos.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Imprime o resumo da busca: os nós resolvidos, o tempo e, se interrompida, o critério, o melhor limite e o gap final
+         *
+         * @param incumbente A solução incumbente
+         */
+
+        void imprimeResumo(const Incumbente &incumbente);
+};
+
+#endif
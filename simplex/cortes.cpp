@@ -0,0 +1,546 @@
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <algorithm>
+#include <utility>
+#include <set>
+
+#include "cortes.hpp"
+
+static const int MAXIMO_CORTES_RODADA = 20; // Novos cortes separados adicionados em cada rodada
+static const double EFICACIA_MINIMA = 1e-4; // Cortes com eficácia menor que esse valor não são adicionados
+static const double PARALELISMO_MAXIMO = 0.99; // Cosseno a partir do qual dois cortes são considerados paralelos
+static const double TOLERANCIA_ATIVO = 1e-6; // Folga a partir da qual um corte é considerado inativo
+static const int IDADE_MAXIMA = 2; // Rodadas seguidas inativo até o corte sair da relaxação
+static const int IDADE_DESCARTE = 5; // Rodadas na reserva sem ser violado até o corte ser descartado
+static const double MELHORA_MINIMA = 1e-4; // Melhora relativa do objetivo abaixo da qual as rodadas terminam
+static const double TOLERANCIA_MOCHILA = 1e-9; // Folga nas comparações de pesos com a capacidade, a favor da validade dos cortes
+static const double VIOLACAO_MINIMA = 1e-6; // Violação mínima de uma desigualdade de cobertura ou de clique para que seja separada
+static const int MAXIMO_CONFLITOS = 1000000; // Arestas do grafo de conflitos a partir das quais as mochilas restantes não geram conflitos
+static const int MAXIMO_INICIOS_CLIQUE = 100; // Literais a partir dos quais uma clique é construída em cada separação
+
+/**
+ * @brief Retorna a eficácia de um corte em uma solução: a violação dividida pela norma, negativa se o corte é satisfeito
+ *
+ */
+
+static double calculaEficacia(const Corte &corte, const std::vector<double> &valores)
+{
+    double produto = 0;
+
+    for (int j = 0 ; j < (int) valores.size() ; j++)
+        produto += corte.coeficientes[j] * valores[j];
+
+    return (corte.lado - produto) / corte.norma;
+}
+
+/**
+ * @brief Indica se dois cortes são quase paralelos, pelo cosseno do ângulo entre os seus coeficientes
+ *
+ */
+
+static bool saoParalelos(const Corte &corte1, const Corte &corte2)
+{
+    double produto = 0;
+
+    for (int j = 0 ; j < (int) corte1.coeficientes.size() ; j++)
+        produto += corte1.coeficientes[j] * corte2.coeficientes[j];
+
+    return std::fabs(produto) >= PARALELISMO_MAXIMO * corte1.norma * corte2.norma;
+}
+
+/**
+ * @brief Indica se um corte é quase paralelo a algum corte de um conjunto
+ *
+ */
+
+static bool temParalelo(const Corte &corte, const std::vector<Corte> &cortes)
+{
+    return std::any_of(cortes.begin(), cortes.end(), [&](const Corte &outro){ return saoParalelos(corte, outro); });
+}
+
+void ReservaCortes::adiciona(Corte corte)
+{
+    corte.idade = 0;
+    cortes.push_back(std::move(corte));
+}
+
+std::vector<Corte> ReservaCortes::retiraViolados(const std::vector<double> &valores)
+{
+    std::vector<Corte> violados;
+    std::vector<Corte> restantes;
+
+    for (auto &corte : cortes)
+    {
+        if (calculaEficacia(corte, valores) >= EFICACIA_MINIMA)
+        {
+            corte.idade = 0;
+            violados.push_back(std::move(corte));
+        }
+
+        else
+            restantes.push_back(std::move(corte));
+    }
+
+    cortes = std::move(restantes);
+
+    return violados;
+}
+
+void ReservaCortes::envelhece()
+{
+    for (auto &corte : cortes)
+        corte.idade++;
+
+    cortes.erase(std::remove_if(cortes.begin(), cortes.end(), [](const Corte &corte){ return corte.idade >= IDADE_DESCARTE; }), cortes.end());
+}
+
+/**
+ * @brief Relaxa uma restrição de igualdade em uma desigualdade <= sobre as variáveis mantidas, substituindo cada uma das demais pelo limite
+ * que minimiza a sua parcela. O sentido -1 relaxa a restrição multiplicada por -1.
+ *
+ * @return false Se alguma variável não mantida não tem o limite necessário
+ */
+
+static bool relaxaRestricao(const std::vector< std::pair<int, double> > &linha, double lado, double sentido, const std::vector<bool> &mantidas,
+                            const SimplexInteiro &raiz, std::vector< std::pair<int, double> > &termos, double &capacidade)
+{
+    termos.clear();
+    capacidade = sentido * lado;
+
+    for (auto &elemento : linha)
+    {
+        double a = sentido * elemento.second;
+
+        if (elemento.first < (int) mantidas.size() && mantidas[elemento.first])
+        {
+            termos.push_back({elemento.first, a});
+            continue;
+        }
+
+        double limite = a > 0 ? raiz.getLimiteInferior(elemento.first) : raiz.getLimiteSuperior(elemento.first);
+
+        if (!std::isfinite(limite))
+            return false;
+
+        capacidade -= a * limite;
+    }
+
+    return true;
+}
+
+EstruturaBinaria::EstruturaBinaria(const SimplexInteiro &raiz, int numVars, const MatrizEsparsa &restricoes, const std::vector<double> &b) : numConflitos(0)
+{
+    std::vector< std::vector< std::pair<int, double> > > linhas(restricoes.getLinhas()); // As restrições por linhas, pois a matriz é armazenada por colunas
+    std::vector<bool> eCanonica(numVars, true);
+    std::vector<bool> eBinaria(numVars, false);
+    std::vector< std::pair<int, double> > termos;
+    double capacidade;
+
+    for (int j = 0 ; j < restricoes.getColunas() ; j++)
+    {
+        for (int p = restricoes.inicioColuna(j) ; p < restricoes.fimColuna(j) ; p++)
+            linhas[restricoes.linhaElemento(p)].push_back({j, restricoes.valorElemento(p)});
+    }
+
+    escalas.resize(numVars);
+
+    for (int j = 0 ; j < numVars ; j++)
+    {
+        escalas[j] = raiz.getEscalaColuna(j);
+        eBinaria[j] = raiz.getLimiteInferior(j) == 0 && raiz.getLimiteSuperior(j) * escalas[j] <= 1 + TOLERANCIA_MOCHILA;
+    }
+
+    for (int i = 0 ; i < (int) linhas.size() ; i++) // Restrições de uma variável só, como x <= 1, limitam a variável
+    {
+        if (relaxaRestricao(linhas[i], b[i], 1, eCanonica, raiz, termos, capacidade) && termos.size() == 1 && termos[0].second > 0)
+        {
+            int j = termos[0].first;
+
+            if (raiz.getLimiteInferior(j) == 0 && capacidade / termos[0].second * escalas[j] <= 1 + TOLERANCIA_MOCHILA)
+                eBinaria[j] = true;
+        }
+    }
+
+    for (int i = 0 ; i < (int) linhas.size() ; i++)
+    {
+        for (double sentido : {1.0, -1.0})
+        {
+            if (!relaxaRestricao(linhas[i], b[i], sentido, eBinaria, raiz, termos, capacidade))
+                continue;
+
+            Mochila mochila;
+            double soma = 0;
+
+            mochila.capacidade = capacidade;
+
+            for (auto &termo : termos) // O peso na escala fornecida. Um peso negativo passa ao complemento: w x = w + |w| (1 - x)
+            {
+                double peso = termo.second / escalas[termo.first];
+
+                if (peso < 0)
+                    mochila.capacidade -= peso;
+
+                if (std::fabs(peso) < TOLERANCIA_MOCHILA) // Sem o literal, a desigualdade continua válida
+                    continue;
+
+                mochila.literais.push_back(2 * termo.first + (peso < 0));
+                mochila.pesos.push_back(std::fabs(peso));
+                soma += std::fabs(peso);
+            }
+
+            /* Se todos os literais cabem juntos, a restrição não os limita */
+
+            if (mochila.literais.size() >= 2 && mochila.capacidade >= 0 && soma > mochila.capacidade + TOLERANCIA_MOCHILA)
+                mochilas.push_back(std::move(mochila));
+        }
+    }
+
+    conflitos.resize(2 * numVars);
+
+    for (auto &mochila : mochilas) // Dois literais conflitam se os seus pesos juntos excedem a capacidade
+    {
+        std::vector<int> ordem(mochila.literais.size());
+
+        std::iota(ordem.begin(), ordem.end(), 0);
+        std::sort(ordem.begin(), ordem.end(), [&](int k1, int k2){ return mochila.pesos[k1] > mochila.pesos[k2]; });
+
+        for (int p = 0 ; p < (int) ordem.size() && numConflitos < MAXIMO_CONFLITOS ; p++)
+        {
+            for (int q = p + 1 ; q < (int) ordem.size() && mochila.pesos[ordem[p]] + mochila.pesos[ordem[q]] > mochila.capacidade + TOLERANCIA_MOCHILA ; q++)
+            {
+                conflitos[mochila.literais[ordem[p]]].push_back(mochila.literais[ordem[q]]);
+                conflitos[mochila.literais[ordem[q]]].push_back(mochila.literais[ordem[p]]);
+                numConflitos++;
+            }
+        }
+    }
+
+    numConflitos = 0;
+
+    for (auto &adjacentes : conflitos) // Uma aresta pode vir de várias restrições
+    {
+        std::sort(adjacentes.begin(), adjacentes.end());
+        adjacentes.erase(std::unique(adjacentes.begin(), adjacentes.end()), adjacentes.end());
+        numConflitos += adjacentes.size();
+    }
+
+    numConflitos /= 2;
+}
+
+bool EstruturaBinaria::separaCobertura(const Mochila &mochila, const std::vector<double> &valoresLiterais, std::vector< std::pair<int, double> > &termos,
+                                        double &lado) const
+{
+    int n = mochila.literais.size();
+    std::vector<int> ordem(n);
+    std::vector<bool> naCobertura(n, false);
+    auto valor = [&](int k){ return valoresLiterais[mochila.literais[k]]; };
+    double peso = 0;
+
+    /* A cobertura é escolhida gulosamente pelo menor (1 - valor) por unidade de peso, e então reduzida a uma cobertura mínima */
+
+    std::iota(ordem.begin(), ordem.end(), 0);
+    std::sort(ordem.begin(), ordem.end(), [&](int k1, int k2){ return (1 - valor(k1)) / mochila.pesos[k1] < (1 - valor(k2)) / mochila.pesos[k2]; });
+
+    for (int k : ordem)
+    {
+        if (peso > mochila.capacidade + TOLERANCIA_MOCHILA)
+            break;
+
+        naCobertura[k] = true;
+        peso += mochila.pesos[k];
+    }
+
+    if (peso <= mochila.capacidade + TOLERANCIA_MOCHILA)
+        return false;
+
+    std::stable_sort(ordem.begin(), ordem.end(), [&](int k1, int k2){ return valor(k1) < valor(k2); });
+
+    for (int k : ordem)
+    {
+        if (naCobertura[k] && peso - mochila.pesos[k] > mochila.capacidade + TOLERANCIA_MOCHILA)
+        {
+            naCobertura[k] = false;
+            peso -= mochila.pesos[k];
+        }
+    }
+
+    /* Elevação sequencial exata: menorPeso[v] é o menor peso que atinge o valor v no lado esquerdo, e o coeficiente de um literal
+       fora da cobertura é o lado direito menos o maior valor que ainda cabe com ele na mochila */
+
+    int direito = std::count(naCobertura.begin(), naCobertura.end(), true) - 1;
+    std::vector<double> menorPeso(direito + 1, std::numeric_limits<double>::infinity());
+    double esquerdo = 0;
+
+    menorPeso[0] = 0;
+    termos.clear();
+
+    for (int k = 0 ; k < n ; k++)
+    {
+        if (!naCobertura[k])
+            continue;
+
+        termos.push_back({mochila.literais[k], 1});
+        esquerdo += valor(k);
+
+        for (int v = direito ; v >= 1 ; v--)
+            menorPeso[v] = std::min(menorPeso[v], menorPeso[v - 1] + mochila.pesos[k]);
+    }
+
+    std::stable_sort(ordem.begin(), ordem.end(), [&](int k1, int k2){ return valor(k1) > valor(k2); }); // Os de maior valor são elevados primeiro
+
+    for (int k : ordem)
+    {
+        if (naCobertura[k])
+            continue;
+
+        double residual = mochila.capacidade - mochila.pesos[k];
+        int coeficiente = direito; // Se o literal sozinho excede a capacidade, ele nunca vale 1
+
+        if (residual >= -TOLERANCIA_MOCHILA)
+        {
+            int maior = 0;
+
+            for (int v = direito ; v >= 0 ; v--)
+            {
+                if (menorPeso[v] <= residual + TOLERANCIA_MOCHILA)
+                {
+                    maior = v;
+                    break;
+                }
+            }
+
+            coeficiente = direito - maior;
+        }
+
+        if (coeficiente <= 0)
+            continue;
+
+        termos.push_back({mochila.literais[k], (double) coeficiente});
+        esquerdo += coeficiente * valor(k);
+
+        for (int v = direito ; v >= coeficiente ; v--)
+            menorPeso[v] = std::min(menorPeso[v], menorPeso[v - coeficiente] + mochila.pesos[k]);
+    }
+
+    lado = direito;
+
+    return esquerdo > direito + VIOLACAO_MINIMA;
+}
+
+Corte EstruturaBinaria::criaCorte(const std::vector< std::pair<int, double> > &termos, double lado, int numColunas) const
+{
+    Corte corte = {std::vector<double>(numColunas, 0), -lado, 0, 0}; // soma c * literal <= lado vira -soma c * literal >= -lado
+
+    for (auto &termo : termos)
+    {
+        int j = termo.first / 2;
+
+        if (termo.first % 2 == 0)
+            corte.coeficientes[j] -= termo.second * escalas[j];
+
+        else // c (1 - x) = c - c x, e a constante passa ao lado direito
+        {
+            corte.coeficientes[j] += termo.second * escalas[j];
+            corte.lado += termo.second;
+        }
+    }
+
+    for (double c : corte.coeficientes)
+        corte.norma += c * c;
+
+    corte.norma = std::sqrt(corte.norma);
+
+    return corte;
+}
+
+std::vector<Corte> EstruturaBinaria::separa(const std::vector<double> &valores) const
+{
+    int numVars = escalas.size();
+    std::vector<double> valoresLiterais(2 * numVars);
+    std::vector<Corte> cortes;
+    std::vector< std::pair<int, double> > termos;
+    double lado;
+
+    for (int j = 0 ; j < numVars ; j++)
+    {
+        valoresLiterais[2 * j] = valores[j] * escalas[j];
+        valoresLiterais[2 * j + 1] = 1 - valoresLiterais[2 * j];
+    }
+
+    for (auto &mochila : mochilas)
+    {
+        if (separaCobertura(mochila, valoresLiterais, termos, lado))
+            cortes.push_back(criaCorte(termos, lado, valores.size()));
+    }
+
+    /* Cada clique parte de um literal de valor positivo e recebe, em ordem de valor, os vizinhos adjacentes a todos os seus literais */
+
+    std::vector<int> inicios;
+    std::set< std::vector<int> > encontradas;
+
+    for (int l = 0 ; l < 2 * numVars ; l++)
+    {
+        if (valoresLiterais[l] > VIOLACAO_MINIMA && !conflitos[l].empty())
+            inicios.push_back(l);
+    }
+
+    std::sort(inicios.begin(), inicios.end(), [&](int l1, int l2){ return valoresLiterais[l1] > valoresLiterais[l2]; });
+
+    if ((int) inicios.size() > MAXIMO_INICIOS_CLIQUE)
+        inicios.resize(MAXIMO_INICIOS_CLIQUE);
+
+    for (int inicio : inicios)
+    {
+        std::vector<int> clique = {inicio};
+        std::vector<int> candidatos = conflitos[inicio];
+        double soma = valoresLiterais[inicio];
+
+        std::stable_sort(candidatos.begin(), candidatos.end(), [&](int l1, int l2){ return valoresLiterais[l1] > valoresLiterais[l2]; });
+
+        for (int candidato : candidatos)
+        {
+            bool adjacente = std::all_of(clique.begin(), clique.end(), [&](int l){ return std::binary_search(conflitos[l].begin(), conflitos[l].end(), candidato); });
+
+            if (adjacente)
+            {
+                clique.push_back(candidato);
+                soma += valoresLiterais[candidato];
+            }
+        }
+
+        std::sort(clique.begin(), clique.end());
+
+        if (soma <= 1 + VIOLACAO_MINIMA || !encontradas.insert(clique).second)
+            continue;
+
+        termos.clear();
+
+        for (int l : clique)
+            termos.push_back({l, 1});
+
+        cortes.push_back(criaCorte(termos, 1, valores.size()));
+    }
+
+    return cortes;
+}
+
+/**
+ * @brief Escolhe os candidatos mais eficazes, descartando os quase paralelos a um corte já escolhido ou existente
+ *
+ * @param candidatos Os cortes separados
+ * @param valores Os valores das colunas do problema fornecido na solução atual, na escala interna
+ * @param ativos Os cortes na relaxação
+ * @param reservados Os cortes na reserva
+ * @param novos Recebe os escolhidos, após os que já contém
+ */
+
+static void escolheCortes(const std::vector<Corte> &candidatos, const std::vector<double> &valores, const std::vector<Corte> &ativos,
+                          const std::vector<Corte> &reservados, std::vector<Corte> &novos)
+{
+    std::vector< std::pair<double, int> > eficacias; // A eficácia de cada candidato e a sua posição
+
+    for (int k = 0 ; k < (int) candidatos.size() ; k++)
+        eficacias.push_back({calculaEficacia(candidatos[k], valores), k});
+
+    std::stable_sort(eficacias.begin(), eficacias.end(), [](const std::pair<double, int> &e1, const std::pair<double, int> &e2){ return e1.first > e2.first; });
+
+    int escolhidos = 0;
+
+    for (auto &eficacia : eficacias) // Um candidato paralelo a um corte mais eficaz acrescentaria pouco a ele
+    {
+        if (eficacia.first < EFICACIA_MINIMA || escolhidos == MAXIMO_CORTES_RODADA)
+            break;
+
+        const Corte &candidato = candidatos[eficacia.second];
+
+        if (temParalelo(candidato, ativos) || temParalelo(candidato, novos) || temParalelo(candidato, reservados))
+            continue;
+
+        novos.push_back(candidato);
+        escolhidos++;
+    }
+}
+
+int aplicaCortesRaiz(SimplexInteiro &raiz, int numVars, int rodadas, const EstruturaBinaria *estrutura)
+{
+    ReservaCortes reserva;
+    std::vector<Corte> ativos; // Os cortes na relaxação, na ordem das suas folgas no tableau
+
+    for (int rodada = 0 ; rodada < rodadas ; rodada++)
+    {
+        std::vector<double> valores = raiz.getValoresColunas();
+        std::vector<Corte> novos = reserva.retiraViolados(valores);
+        std::vector<Corte> candidatos = raiz.separaGomory(numVars, ativos);
+
+        if (estrutura)
+        {
+            std::vector<Corte> combinatorios = estrutura->separa(valores);
+
+            candidatos.insert(candidatos.end(), combinatorios.begin(), combinatorios.end());
+        }
+
+        escolheCortes(candidatos, valores, ativos, reserva.getCortes(), novos);
+
+        if (novos.empty())
+            break;
+
+        double anterior = raiz.getSolucaoOtima();
+
+        for (auto &corte : novos)
+        {
+            raiz.adicionaCorte(corte);
+            ativos.push_back(corte);
+        }
+
+        raiz.aplicaSimplex({}); // O Simplex dual restaura a viabilidade a partir da base ótima anterior
+
+        if (raiz.getSemSolucao() || raiz.getEIlimitado()) // Sem solução inteira: os cortes são válidos para todas elas
+            return ativos.size();
+
+        reserva.envelhece();
+
+        for (int k = (int) ativos.size() - 1 ; k >= 0 ; k--) // De trás para frente, pois a remoção desloca as folgas dos cortes seguintes
+        {
+            ativos[k].idade = raiz.getFolgaCorte(k) > TOLERANCIA_ATIVO ? ativos[k].idade + 1 : 0;
+
+            if (ativos[k].idade >= IDADE_MAXIMA && raiz.removeCorte(k))
+            {
+                reserva.adiciona(ativos[k]);
+                ativos.erase(ativos.begin() + k);
+            }
+        }
+
+        if (retornaPosicaoNaoInteiro(raiz.getSolucao(numVars)) == -1)
+            break;
+
+        if (anterior - raiz.getSolucaoOtima() <= MELHORA_MINIMA * std::max(1.0, std::fabs(anterior)))
+            break;
+    }
+
+    for (int k = (int) ativos.size() - 1 ; k >= 0 ; k--)
+    {
+        if (raiz.getFolgaCorte(k) > TOLERANCIA_ATIVO && raiz.removeCorte(k))
+            ativos.erase(ativos.begin() + k);
+    }
+
+    return ativos.size();
+}
+
+int aplicaCortesNo(SimplexInteiro &no, const EstruturaBinaria &estrutura)
+{
+    std::vector<double> valores = no.getValoresColunas();
+    std::vector<Corte> novos;
+
+    escolheCortes(estrutura.separa(valores), valores, {}, {}, novos);
+
+    if (novos.empty())
+        return 0;
+
+    for (auto &corte : novos)
+        no.adicionaCorte(corte);
+
+    no.aplicaSimplex({});
+
+    return novos.size();
+}
@@ -0,0 +1,152 @@
+#ifndef CORTES_H
+#define CORTES_H
+
+/**
+ * @file cortes.hpp
+ * @brief Declaração da reserva de cortes, da estrutura binária das restrições e das rodadas de cortes do Branch and Bound.
+ *
+ */
+
+#include <vector>
+#include <utility>
+
+#include "simplex_inteiro.hpp"
+#include "../util/matriz_esparsa.hpp"
+
+/**
+ * @brief Reserva dos cortes retirados da relaxação da raiz por ficarem inativos. Um corte da reserva volta à relaxação quando a solução
+ * de uma rodada posterior o viola, e é descartado se permanece muitas rodadas sem ser violado.
+ *
+ */
+
+class ReservaCortes
+{
+    private:
+        std::vector<Corte> cortes; // Os cortes guardados, com a idade contada desde a entrada na reserva
+
+    public:
+        /**
+         * @brief Guarda um corte retirado da relaxação
+         *
+         * @param corte O corte
+         */
+
+        void adiciona(Corte corte);
+
+        /**
+         * @brief Retira da reserva os cortes violados por uma solução
+         *
+         * @param valores Os valores das colunas do problema fornecido, na escala interna
+         * @return std::vector<Corte> Os cortes violados
+         */
+
+        std::vector<Corte> retiraViolados(const std::vector<double> &valores);
+
+        /**
+         * @brief Aumenta a idade de todos os cortes da reserva, descartando os que atingem a idade de descarte
+         *
+         */
+
+        void envelhece();
+
+        const std::vector<Corte> &getCortes() const { return cortes; }
+};
+
+/**
+ * @brief Uma desigualdade de mochila sobre literais binários, soma pesos_k * literal_k <= capacidade com pesos positivos,
+ * implicada por uma restrição do problema. O literal 2j é x_j e o literal 2j + 1 é o complemento 1 - x_j, na escala do problema fornecido.
+ *
+ */
+
+typedef struct
+{
+    std::vector<int> literais; // Os literais da desigualdade
+    std::vector<double> pesos; // O peso de cada literal
+    double capacidade; // O lado direito
+} Mochila;
+
+/**
+ * @brief A estrutura das restrições sobre as variáveis binárias: as mochilas implicadas pelas restrições e o grafo de conflitos,
+ * em que dois literais são adjacentes se não podem valer 1 ao mesmo tempo. Separa desigualdades de cobertura elevadas das mochilas
+ * e cortes de clique do grafo de conflitos. Não é alterada após a construção, então pode ser usada por todas as threads.
+ *
+ */
+
+class EstruturaBinaria
+{
+    private:
+        std::vector<double> escalas; // Fator de escala de cada variável da forma canônica
+        std::vector<Mochila> mochilas; // As mochilas com pelo menos dois literais que não cabem juntos
+        std::vector< std::vector<int> > conflitos; // Os literais adjacentes a cada literal, em ordem crescente
+        int numConflitos; // Número de arestas do grafo de conflitos
+
+        /**
+         * @brief Separa a desigualdade de cobertura elevada de uma mochila, se violada
+         *
+         */
+
+        bool separaCobertura(const Mochila &mochila, const std::vector<double> &valoresLiterais, std::vector< std::pair<int, double> > &termos, double &lado) const;
+
+        /**
+         * @brief Converte uma desigualdade soma coeficiente * literal <= lado em um corte sobre as colunas do problema fornecido
+         *
+         */
+
+        Corte criaCorte(const std::vector< std::pair<int, double> > &termos, double lado, int numColunas) const;
+
+    public:
+        /**
+         * @brief Detecta as mochilas e os conflitos. As variáveis binárias são as da forma canônica com limite inferior 0 e limite superior
+         * até 1, dado na entrada ou implicado por uma restrição de uma variável só, como x <= 1. Uma restrição gera uma mochila em cada sentido
+         * em que as variáveis não binárias podem ser substituídas pelos seus limites.
+         *
+         * @param raiz O problema da raiz, com os limites das variáveis
+         * @param numVars Número de variáveis na forma canônica
+         * @param restricoes As restrições do problema, na escala interna
+         * @param b O vetor de soluções das restrições
+         */
+
+        EstruturaBinaria(const SimplexInteiro &raiz, int numVars, const MatrizEsparsa &restricoes, const std::vector<double> &b);
+
+        int getNumMochilas() const { return mochilas.size(); }
+
+        int getNumConflitos() const { return numConflitos; }
+
+        /**
+         * @brief Separa as desigualdades de cobertura elevadas e os cortes de clique violados por uma solução
+         *
+         * @param valores Os valores das colunas do problema fornecido, na escala interna
+         * @return std::vector<Corte> Os cortes violados
+         */
+
+        std::vector<Corte> separa(const std::vector<double> &valores) const;
+};
+
+/**
+ * @brief Realiza as rodadas de cortes na raiz: de Gomory inteiros mistos e, se há estrutura binária, de cobertura e de clique.
+ * Em cada rodada, os cortes da reserva violados pela solução atual voltam à relaxação, e os novos cortes são escolhidos pela eficácia,
+ * a distância euclidiana da solução ao hiperplano do corte, descartando os quase paralelos a um corte já escolhido, na relaxação ou na reserva. A relaxação é reotimizada pelo Simplex dual, e os cortes que ficam
+ * inativos por algumas rodadas seguidas vão para a reserva. As rodadas terminam quando não há corte eficaz, quando a solução fica inteira
+ * ou quando o objetivo para de melhorar. Ao final, os cortes inativos são retirados, para não aumentar o tableau de cada nó.
+ *
+ * @param raiz O problema da raiz, já resolvido
+ * @param numVars Número de variáveis na forma canônica
+ * @param rodadas Número máximo de rodadas
+ * @param estrutura A estrutura binária do problema, ou nulo
+ * @return int O número de cortes na relaxação da raiz ao final
+ */
+
+int aplicaCortesRaiz(SimplexInteiro &raiz, int numVars, int rodadas, const EstruturaBinaria *estrutura);
+
+/**
+ * @brief Realiza uma rodada de cortes de cobertura e de clique em um nó já resolvido, reotimizando-o pelo Simplex dual.
+ * Os cortes valem apenas no tableau do nó e nos filhos que o copiam.
+ *
+ * @param no O nó
+ * @param estrutura A estrutura binária do problema
+ * @return int O número de cortes adicionados
+ */
+
+int aplicaCortesNo(SimplexInteiro &no, const EstruturaBinaria &estrutura);
+
+#endif
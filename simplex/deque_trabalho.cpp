@@ -0,0 +1,89 @@
+#include "deque_trabalho.hpp"
+
+static const long long CAPACIDADE_INICIAL = 64; // Capacidade do primeiro vetor circular, suficiente para a maioria das árvores
+
+DequeTrabalho::DequeTrabalho() : topo(0), fundo(0)
+{
+    vetor.store(criaVetor(CAPACIDADE_INICIAL), std::memory_order_relaxed);
+}
+
+DequeTrabalho::Vetor *DequeTrabalho::criaVetor(long long capacidade)
+{
+    std::unique_ptr<Vetor> novo(new Vetor);
+
+    novo->capacidade = capacidade;
+    novo->nos.reset(new std::atomic<NoAberto*>[capacidade]);
+
+    vetores.push_back(std::move(novo));
+
+    return vetores.back().get();
+}
+
+void DequeTrabalho::insere(NoAberto *no)
+{
+    long long f = fundo.load(std::memory_order_relaxed);
+    long long t = topo.load(std::memory_order_acquire);
+    Vetor *v = vetor.load(std::memory_order_relaxed);
+
+    if (f - t > v->capacidade - 1) // Cheio: copia os nós para um vetor com o dobro da capacidade, nas mesmas posições lógicas
+    {
+        Vetor *maior = criaVetor(2 * v->capacidade);
+
+        for (long long i = t ; i < f ; i++)
+            maior->nos[i & (maior->capacidade - 1)].store(v->nos[i & (v->capacidade - 1)].load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+        vetor.store(maior, std::memory_order_release);
+        v = maior;
+    }
+
+    v->nos[f & (v->capacidade - 1)].store(no, std::memory_order_release); // O conteúdo do nó fica visível para o ladrão que ler a posição
+    std::atomic_thread_fence(std::memory_order_release); // A posição fica visível antes do novo fundo
+    fundo.store(f + 1, std::memory_order_relaxed);
+}
+
+NoAberto *DequeTrabalho::retira()
+{
+    long long f = fundo.load(std::memory_order_relaxed) - 1;
+    Vetor *v = vetor.load(std::memory_order_relaxed);
+
+    fundo.store(f, std::memory_order_relaxed); // Reserva o nó do fundo antes de olhar o topo
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    long long t = topo.load(std::memory_order_relaxed);
+
+    if (t > f) // Vazio
+    {
+        fundo.store(f + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    NoAberto *no = v->nos[f & (v->capacidade - 1)].load(std::memory_order_relaxed);
+
+    if (t == f) // Último nó: disputa com os ladrões pelo topo
+    {
+        if (!topo.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            no = nullptr;
+
+        fundo.store(f + 1, std::memory_order_relaxed);
+    }
+
+    return no;
+}
+
+NoAberto *DequeTrabalho::rouba()
+{
+    long long t = topo.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    long long f = fundo.load(std::memory_order_acquire);
+
+    if (t >= f) // Vazio
+        return nullptr;
+
+    Vetor *v = vetor.load(std::memory_order_acquire);
+    NoAberto *no = v->nos[t & (v->capacidade - 1)].load(std::memory_order_acquire);
+
+    if (!topo.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return nullptr; // Outra thread levou o nó
+
+    return no;
+}
@@ -0,0 +1,83 @@
+#ifndef DEQUE_TRABALHO_H
+#define DEQUE_TRABALHO_H
+
+/**
+ * @file deque_trabalho.hpp
+ * @brief Arquivo contendo a classe DequeTrabalho, o deque sem travas de cada thread no roubo de trabalho do Branch and Bound.
+ *
+ */
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "simplex_inteiro.hpp"
+
+/**
+ * @brief Deque de Chase e Lev, com as ordens de memória de Lê et al. (2013), para nós abertos do Branch and Bound.
+ *
+ * Apenas a thread dona insere e retira no fundo, como uma pilha, o que mantém a busca em profundidade de cada thread.
+ * As demais threads roubam do topo os nós mais antigos, que são os mais rasos e tendem a ter as maiores sub-árvores.
+ * Nenhuma operação trava: a disputa pelo último nó é resolvida por uma troca atômica no topo.
+ * O vetor circular dobra de tamanho quando fica cheio. Os vetores antigos são mantidos até a destruição do deque,
+ * pois um ladrão ainda pode estar lendo deles.
+ */
+
+class DequeTrabalho
+{
+    private:
+        /**
+         * @brief Vetor circular de nós, com capacidade potência de 2
+         *
+         */
+
+        typedef struct
+        {
+            long long capacidade; // Número de posições
+            std::unique_ptr< std::atomic<NoAberto*>[] > nos; // As posições do vetor, indexadas módulo a capacidade
+        } Vetor;
+
+        std::atomic<long long> topo; // Posição do nó mais antigo, de onde os ladrões retiram
+        std::atomic<long long> fundo; // Posição após o nó mais recente, onde a dona insere e retira
+        std::atomic<Vetor*> vetor; // O vetor em uso
+        std::vector< std::unique_ptr<Vetor> > vetores; // Todos os vetores já alocados, acessado apenas pela dona
+
+        /**
+         * @brief Aloca um vetor vazio com a capacidade fornecida e o guarda em vetores
+         *
+         */
+
+        Vetor *criaVetor(long long capacidade);
+
+    public:
+        DequeTrabalho();
+
+        DequeTrabalho(const DequeTrabalho &) = delete;
+
+        DequeTrabalho &operator=(const DequeTrabalho &) = delete;
+
+        /**
+         * @brief Insere um nó no fundo. Apenas a thread dona pode chamar.
+         *
+         */
+
+        void insere(NoAberto *no);
+
+        /**
+         * @brief Retira o nó mais recente, no fundo. Apenas a thread dona pode chamar.
+         *
+         * @return NoAberto* O nó, ou nulo se o deque está vazio ou o último nó foi roubado
+         */
+
+        NoAberto *retira();
+
+        /**
+         * @brief Rouba o nó mais antigo, no topo. Pode ser chamada por qualquer thread.
+         *
+         * @return NoAberto* O nó, ou nulo se o deque está vazio ou outra thread levou o nó primeiro
+         */
+
+        NoAberto *rouba();
+};
+
+#endif
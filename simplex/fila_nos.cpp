@@ -0,0 +1,53 @@
+#include "fila_nos.hpp"
+
+static const int PERIODO_MELHOR_LIMITE = 10; // Na busca em profundidade, a cada quantos nós retirados um é escolhido pelo melhor limite
+
+FilaNos::FilaNos(RegraSelecaoNo regra) : regra(regra), proximaOrdem(0), retiradas(0)
+{
+
+}
+
+void FilaNos::defineRegra(RegraSelecaoNo regra)
+{
+    this->regra = regra;
+}
+
+void FilaNos::insere(NoAberto no)
+{
+    double chave = regra == RegraSelecaoNo::MELHOR_ESTIMATIVA ? no.estimativa : no.limitePai;
+    long long ordem = proximaOrdem++;
+
+    prioridades.insert({chave, ordem});
+    nos.emplace(ordem, EntradaFilaNos{std::move(no), chave});
+}
+
+NoAberto FilaNos::retiraNo(long long ordem)
+{
+    auto it = nos.find(ordem);
+    NoAberto no = std::move(it->second.no);
+
+    prioridades.erase({it->second.chave, ordem});
+    nos.erase(it);
+
+    return no;
+}
+
+NoAberto FilaNos::retira()
+{
+    retiradas++;
+
+    switch (regra)
+    {
+        case RegraSelecaoNo::LARGURA:
+            return retiraNo(nos.begin()->first);
+
+        case RegraSelecaoNo::PROFUNDIDADE:
+            if (retiradas % PERIODO_MELHOR_LIMITE != 0) // O último nó inserido é um filho do último nó ramificado
+                return retiraNo(nos.rbegin()->first);
+
+            return retiraNo(prioridades.rbegin()->second); // Periodicamente, volta ao nó mais promissor para não ficar preso em uma sub-árvore
+
+        default:
+            return retiraNo(prioridades.rbegin()->second);
+    }
+}
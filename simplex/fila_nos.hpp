@@ -0,0 +1,93 @@
+#ifndef FILA_NOS_H
+#define FILA_NOS_H
+
+/**
+ * @file fila_nos.hpp
+ * @brief Arquivo contendo a classe FilaNos, que guarda os nós abertos do Branch and Bound e escolhe o próximo a ser resolvido.
+ *
+ */
+
+#include <map>
+#include <set>
+#include <utility>
+
+#include "simplex_inteiro.hpp"
+#include "../util/configuracao.hpp"
+
+/**
+ * @brief Um nó aberto e a chave de prioridade dele.
+ *
+ */
+
+typedef struct
+{
+    NoAberto no; // O nó, ainda não resolvido
+    double chave; // O limite do pai ou a estimativa, conforme a regra. Quanto maior, mais promissor
+} EntradaFilaNos;
+
+/**
+ * @brief Conjunto de nós abertos do Branch and Bound, com a escolha do próximo nó conforme uma regra de seleção.
+ *
+ * Os nós ficam em ordem de inserção, o que atende às buscas em largura e em profundidade, e em um conjunto ordenado pela chave,
+ * o que atende às regras de melhor limite e de melhor estimativa. As duas estruturas permitem inserir e retirar em O(log n).
+ * Como os nós são resolvidos apenas ao serem retirados, a chave é o valor da relaxação linear do pai, que limita o valor do nó.
+ * Em caso de empate na chave, o nó mais recente é escolhido, o que aprofunda a busca e tende a encontrar soluções inteiras mais cedo.
+ * No mergulho, a fila não guarda nós: cada thread empilha os irmãos em um DequeTrabalho próprio, e a regra da fila apenas indica esse caminho.
+ */
+
+class FilaNos
+{
+    private:
+        RegraSelecaoNo regra; // Regra de escolha do próximo nó
+        std::map<long long, EntradaFilaNos> nos; // Nós abertos, pela ordem de inserção
+        std::set< std::pair<double, long long> > prioridades; // Chave e ordem de inserção de cada nó aberto
+        long long proximaOrdem; // Ordem de inserção do próximo nó
+        long long retiradas; // Número de nós retirados, para a escolha periódica pelo melhor limite na busca em profundidade
+
+        /**
+         * @brief Retira o nó da ordem de inserção fornecida
+         *
+         */
+
+        NoAberto retiraNo(long long ordem);
+
+    public:
+        /**
+         * @brief Cria uma fila vazia
+         *
+         * @param regra A regra de escolha do próximo nó
+         */
+
+        FilaNos(RegraSelecaoNo regra = RegraSelecaoNo::MELHOR_LIMITE);
+
+        /**
+         * @brief Altera a regra de escolha. Deve ser chamada com a fila vazia, pois as chaves dos nós já inseridos não são recalculadas.
+         *
+         */
+
+        void defineRegra(RegraSelecaoNo regra);
+
+        RegraSelecaoNo getRegra() const { return regra; }
+
+        /**
+         * @brief Insere um nó ainda não resolvido. Não é usada no mergulho
+         *
+         * @param no O nó, com o limite do pai e a estimativa já definidos
+         */
+
+        void insere(NoAberto no);
+
+        /**
+         * @brief Retira o próximo nó conforme a regra. A fila não pode estar vazia, e não é usada no mergulho.
+         *
+         * @return NoAberto O nó escolhido
+         */
+
+        NoAberto retira();
+
+        bool vazia() const { return nos.empty(); }
+
+        int tamanho() const { return nos.size(); }
+};
+
+#endif
@@ -0,0 +1,352 @@
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <algorithm>
+#include <random>
+
+#include "heuristicas.hpp"
+
+static const double TOLERANCIA_LINHA = 1e-9; // Violação relativa de uma restrição tolerada antes da confirmação pelo Simplex dual
+static const int MAXIMO_PASSADAS_ZI = 20; // Passadas do arredondamento ZI sobre as coordenadas fracionárias
+static const int MAXIMO_PASSOS_MERGULHO = 1000; // Variáveis fixadas em um mergulho
+static const int MAXIMO_ITERACOES_BOMBA = 50; // Resoluções da relaxação pela bomba de viabilidade
+static const int TROCAS_CICLO_BOMBA = 10; // Número médio de coordenadas que trocam de lado quando o arredondamento se repete
+
+/**
+ * @brief Oferece à incumbente uma solução inteira da relaxação de um nó, que já é viável
+ *
+ * @return true Se a incumbente melhorou
+ */
+
+static bool publicaSolucao(double valor, std::vector<double> solucao, Incumbente &incumbente)
+{
+    if (!(valor > incumbente.getValor())) // Uma solução de mesmo valor não ajuda as podas
+        return false;
+
+    for (double &coordenada : solucao) // Remove o resíduo numérico dos pivoteamentos
+        coordenada = std::round(coordenada);
+
+    return incumbente.atualiza(valor, solucao);
+}
+
+Heuristicas::Heuristicas(const SimplexInteiro &raiz, int numVars, const MatrizEsparsa &restricoes, const std::vector<double> &b, const std::vector<double> &c)
+    : numVars(numVars), escalas(numVars), colunas(numVars), minimoLinha(b), maximoLinha(b), travaAbaixo(numVars, false), travaAcima(numVars, false),
+      custos(numVars), estimaObjetivo(true)
+{
+    std::vector<double> valores = raiz.getValoresColunas();
+    double parcelaVariaveis = 0; // O objetivo interno da solução da raiz sem o deslocamento
+
+    for (int j = 0 ; j < numVars ; j++)
+        escalas[j] = raiz.getEscalaColuna(j);
+
+    for (int j = 0 ; j < restricoes.getColunas() ; j++) // O objetivo interno é -c^T x na maximização e c^T x na minimização
+    {
+        double custo = raiz.getTipoProblema() ? -c[j] : c[j];
+
+        if (j < numVars)
+        {
+            custos[j] = custo / escalas[j];
+            parcelaVariaveis += custo * valores[j];
+        }
+
+        else if (custo != 0)
+            estimaObjetivo = false;
+    }
+
+    deslocamento = raiz.getSolucaoOtima() - parcelaVariaveis; // A constante das variáveis removidas pelo presolve
+
+    for (int j = 0 ; j < restricoes.getColunas() ; j++)
+    {
+        for (int p = restricoes.inicioColuna(j) ; p < restricoes.fimColuna(j) ; p++)
+        {
+            int i = restricoes.linhaElemento(p);
+            double a = restricoes.valorElemento(p);
+
+            if (j < numVars)
+            {
+                colunas[j].push_back({i, a / escalas[j]});
+                continue;
+            }
+
+            /* A folga ocupa o intervalo entre a vezes os seus limites, e a soma das demais variáveis é o lado direito menos ela */
+
+            double extremo1 = a * raiz.getLimiteInferior(j);
+            double extremo2 = a * raiz.getLimiteSuperior(j);
+
+            minimoLinha[i] -= std::max(extremo1, extremo2);
+            maximoLinha[i] -= std::min(extremo1, extremo2);
+        }
+    }
+
+    for (int j = 0 ; j < numVars ; j++)
+    {
+        for (auto &elemento : colunas[j]) // Diminuir uma variável de coeficiente positivo só é seguro se a restrição não tem mínimo
+        {
+            bool semMinimo = minimoLinha[elemento.first] == -std::numeric_limits<double>::infinity();
+            bool semMaximo = maximoLinha[elemento.first] == std::numeric_limits<double>::infinity();
+
+            travaAbaixo[j] = travaAbaixo[j] || (elemento.second > 0 ? !semMinimo : !semMaximo);
+            travaAcima[j] = travaAcima[j] || (elemento.second > 0 ? !semMaximo : !semMinimo);
+        }
+    }
+}
+
+std::vector<double> Heuristicas::calculaAtividades(const std::vector<double> &valores) const
+{
+    std::vector<double> atividades(minimoLinha.size(), 0);
+
+    for (int j = 0 ; j < numVars ; j++)
+    {
+        for (auto &elemento : colunas[j])
+            atividades[elemento.first] += elemento.second * valores[j];
+    }
+
+    return atividades;
+}
+
+double Heuristicas::calculaValor(const std::vector<double> &valores) const
+{
+    if (!estimaObjetivo)
+        return std::numeric_limits<double>::infinity();
+
+    double valor = deslocamento;
+
+    for (int j = 0 ; j < numVars ; j++)
+        valor += custos[j] * valores[j];
+
+    return valor;
+}
+
+bool Heuristicas::confirmaCandidata(const SimplexInteiro &problema, const std::vector<double> &candidata, Incumbente &incumbente) const
+{
+    SimplexInteiro verificacao(problema);
+    std::vector<AlteracaoLimite> fixacoes;
+
+    for (int j = 0 ; j < numVars ; j++) // A fixação substitui os limites, então a candidata deve respeitá-los
+    {
+        double valor = candidata[j] / escalas[j];
+
+        if (valor < problema.getLimiteInferior(j) - TOLERANCIA_LINHA || valor > problema.getLimiteSuperior(j) + TOLERANCIA_LINHA)
+            return false;
+
+        fixacoes.push_back({j, valor, valor});
+    }
+
+    verificacao.aplicaAlteracoes(fixacoes);
+    verificacao.aplicaSimplex({}); // Com as variáveis fixadas, o Simplex dual apenas calcula as folgas, ou prova que a candidata é inviável
+
+    if (verificacao.getSemSolucao() || verificacao.getEIlimitado())
+        return false;
+
+    std::vector<double> solucao = verificacao.getSolucao(numVars);
+
+    if (retornaPosicaoNaoInteiro(solucao) != -1)
+        return false;
+
+    return publicaSolucao(verificacao.getSolucaoOtima(), solucao, incumbente);
+}
+
+bool Heuristicas::arredonda(const SimplexInteiro &problema, const std::vector<double> &solucao, bool zi, Incumbente &incumbente) const
+{
+    std::vector<double> valores(solucao);
+    std::vector<double> atividades = calculaAtividades(valores);
+
+    for (int passada = 0 ; passada < (zi ? MAXIMO_PASSADAS_ZI : 1) ; passada++)
+    {
+        bool alterou = false;
+
+        for (int j = 0 ; j < numVars ; j++)
+        {
+            if (eInteiro(valores[j]))
+                continue;
+
+            double fracao = valores[j] - std::floor(valores[j]);
+            bool abaixo;
+
+            if (!zi) // No arredondamento simples, o lado sem trava, em que nenhuma restrição pode ser violada
+            {
+                if (travaAbaixo[j] && travaAcima[j])
+                    return false;
+
+                abaixo = !travaAbaixo[j];
+            }
+
+            else // No ZI, o maior movimento em cada direção que mantém os limites e as restrições
+            {
+                double folgaAbaixo = valores[j] - problema.getLimiteInferior(j) * escalas[j];
+                double folgaAcima = problema.getLimiteSuperior(j) * escalas[j] - valores[j];
+
+                for (auto &elemento : colunas[j])
+                {
+                    int i = elemento.first;
+                    double w = elemento.second;
+                    double paraMinimo = std::max(atividades[i] - minimoLinha[i], 0.0) / std::fabs(w);
+                    double paraMaximo = std::max(maximoLinha[i] - atividades[i], 0.0) / std::fabs(w);
+
+                    folgaAbaixo = std::min(folgaAbaixo, w > 0 ? paraMinimo : paraMaximo);
+                    folgaAcima = std::min(folgaAcima, w > 0 ? paraMaximo : paraMinimo);
+                }
+
+                bool podeAbaixo = fracao <= folgaAbaixo + TOLERANCIA_LINHA;
+                bool podeAcima = 1 - fracao <= folgaAcima + TOLERANCIA_LINHA;
+
+                if (!podeAbaixo && !podeAcima) // Uma passada seguinte pode encontrar mais folga
+                    continue;
+
+                if (podeAbaixo && podeAcima) // Os dois lados cabem: o de melhor objetivo, ou o mais próximo
+                    abaixo = custos[j] != 0 ? custos[j] < 0 : fracao <= 0.5;
+                else
+                    abaixo = podeAbaixo;
+            }
+
+            double variacao = abaixo ? -fracao : 1 - fracao;
+
+            valores[j] = abaixo ? std::floor(valores[j]) : std::ceil(valores[j]);
+
+            for (auto &elemento : colunas[j])
+                atividades[elemento.first] += elemento.second * variacao;
+
+            alterou = true;
+        }
+
+        if (!alterou)
+            break;
+    }
+
+    if (retornaPosicaoNaoInteiro(valores) != -1)
+        return false;
+
+    for (int i = 0 ; i < (int) atividades.size() ; i++) // A confirmação só é feita se as folgas comportam a candidata
+    {
+        if (atividades[i] < minimoLinha[i] - TOLERANCIA_LINHA * (1 + std::fabs(minimoLinha[i])) ||
+            atividades[i] > maximoLinha[i] + TOLERANCIA_LINHA * (1 + std::fabs(maximoLinha[i])))
+            return false;
+    }
+
+    if (!(calculaValor(valores) > incumbente.getValor())) // A confirmação só interessa se a candidata supera a incumbente
+        return false;
+
+    return confirmaCandidata(problema, valores, incumbente);
+}
+
+bool Heuristicas::mergulha(const SimplexInteiro &problema, bool guiado, Incumbente &incumbente) const
+{
+    std::vector<double> guia; // As coordenadas da incumbente, no mergulho guiado
+
+    if (guiado && incumbente.leSolucao(guia) == -std::numeric_limits<double>::infinity())
+        return false;
+
+    SimplexInteiro mergulho(problema);
+
+    for (int passo = 0 ; passo < MAXIMO_PASSOS_MERGULHO ; passo++)
+    {
+        std::vector<double> solucao = mergulho.getSolucao(numVars);
+        int escolhida = -1;
+        bool acima = false;
+        double menorDistancia = std::numeric_limits<double>::infinity();
+
+        for (int j = 0 ; j < numVars ; j++)
+        {
+            if (eInteiro(solucao[j]))
+                continue;
+
+            double fracao = solucao[j] - std::floor(solucao[j]);
+            double distancia = guiado ? std::fabs(solucao[j] - guia[j]) : std::min(fracao, 1 - fracao);
+
+            if (distancia < menorDistancia)
+            {
+                escolhida = j;
+                acima = guiado ? guia[j] > solucao[j] : fracao >= 0.5;
+                menorDistancia = distancia;
+            }
+        }
+
+        if (escolhida == -1) // A relaxação do mergulho é inteira
+            return publicaSolucao(mergulho.getSolucaoOtima(), solucao, incumbente);
+
+        double piso = std::floor(solucao[escolhida]);
+        SimplexInteiro tentativa(mergulho);
+
+        tentativa.adicionaRamificacao(escolhida, acima ? piso + 1 : piso, !acima);
+        tentativa.aplicaSimplex({});
+
+        if (tentativa.getSemSolucao()) // Retrocede uma vez, para o lado oposto
+        {
+            mergulho.adicionaRamificacao(escolhida, acima ? piso : piso + 1, acima);
+            mergulho.aplicaSimplex({});
+        }
+
+        else
+            mergulho = std::move(tentativa);
+
+        if (mergulho.getSemSolucao() || mergulho.getEIlimitado() || !(mergulho.getSolucaoOtima() > incumbente.getValor()))
+            return false;
+    }
+
+    return false;
+}
+
+bool Heuristicas::bombaViabilidade(const SimplexInteiro &problema, Incumbente &incumbente) const
+{
+    SimplexInteiro bomba(problema);
+    std::vector<double> solucao = bomba.getSolucao(numVars);
+    std::vector<double> arredondada(numVars);
+    std::vector<double> anterior;
+    std::vector<int> ordem(numVars);
+    std::mt19937 gerador(numVars); // Semente fixa, para que a execução seja reprodutível
+    std::uniform_int_distribution<int> distribuicao(TROCAS_CICLO_BOMBA / 2, 3 * TROCAS_CICLO_BOMBA / 2);
+
+    for (int iteracao = 0 ; iteracao < MAXIMO_ITERACOES_BOMBA ; iteracao++)
+    {
+        if (retornaPosicaoNaoInteiro(solucao) == -1) // A relaxação chegou a um ponto inteiro, que é viável
+            return calculaValor(solucao) > incumbente.getValor() && confirmaCandidata(problema, solucao, incumbente);
+
+        for (int j = 0 ; j < numVars ; j++)
+        {
+            double inferior = problema.getLimiteInferior(j) * escalas[j];
+            double superior = problema.getLimiteSuperior(j) * escalas[j];
+
+            arredondada[j] = std::min(std::max(std::round(solucao[j]), std::ceil(inferior - TOLERANCIA_LINHA)), std::floor(superior + TOLERANCIA_LINHA));
+        }
+
+        if (arredondada == anterior) // Ciclo: as coordenadas mais distantes da relaxação vão para o outro lado
+        {
+            std::iota(ordem.begin(), ordem.end(), 0);
+            std::sort(ordem.begin(), ordem.end(), [&](int j1, int j2){ return std::fabs(solucao[j1] - arredondada[j1]) > std::fabs(solucao[j2] - arredondada[j2]); });
+
+            int trocas = std::min(distribuicao(gerador), numVars);
+
+            for (int k = 0 ; k < trocas && !eInteiro(solucao[ordem[k]]) ; k++)
+            {
+                int j = ordem[k];
+
+                arredondada[j] = solucao[j] > arredondada[j] ? std::ceil(solucao[j]) : std::floor(solucao[j]);
+            }
+        }
+
+        anterior = arredondada;
+
+        /* A distância de uma variável no limite inferior é x - inferior, e no superior, superior - x. O objetivo interno é -C^T x */
+
+        std::vector<double> distancia(numVars, 0);
+
+        for (int j = 0 ; j < numVars ; j++)
+        {
+            if (std::fabs(arredondada[j] - problema.getLimiteInferior(j) * escalas[j]) <= TOLERANCIA_LINHA)
+                distancia[j] = escalas[j];
+
+            else if (std::fabs(arredondada[j] - problema.getLimiteSuperior(j) * escalas[j]) <= TOLERANCIA_LINHA)
+                distancia[j] = -escalas[j];
+        }
+
+        bomba.defineObjetivo(distancia);
+        bomba.aplicaSimplex({});
+
+        if (bomba.getSemSolucao() || bomba.getEIlimitado())
+            return false;
+
+        solucao = bomba.getSolucao(numVars);
+    }
+
+    return false;
+}
@@ -0,0 +1,115 @@
+#ifndef HEURISTICAS_H
+#define HEURISTICAS_H
+
+/**
+ * @file heuristicas.hpp
+ * @brief Declaração das heurísticas primais do Branch and Bound, que procuram soluções inteiras para a incumbente antes que a árvore as encontre.
+ *
+ */
+
+#include <vector>
+#include <utility>
+
+#include "simplex_inteiro.hpp"
+#include "incumbente.hpp"
+#include "../util/matriz_esparsa.hpp"
+
+/**
+ * @brief Heurísticas primais: arredondamento simples e ZI sobre as restrições, mergulhos fracionário e guiado e a bomba de viabilidade.
+ *
+ * Uma candidata dos arredondamentos ou da bomba que supera a incumbente é confirmada por um Simplex dual sobre uma cópia do nó com as
+ * variáveis da forma canônica fixadas nos valores da candidata, que calcula as folgas e o valor no objetivo interno. Só então a candidata
+ * é oferecida à incumbente.
+ * A estrutura das restrições não é alterada após a construção, e cada heurística trabalha sobre as suas próprias cópias do nó,
+ * então as heurísticas podem ser aplicadas por todas as threads ao mesmo tempo.
+ */
+
+class Heuristicas
+{
+    private:
+        int numVars; // Número de variáveis da forma canônica, as inteiras
+        std::vector<double> escalas; // Fator de escala de cada variável da forma canônica
+        std::vector< std::vector< std::pair<int, double> > > colunas; // As restrições de cada variável, com o coeficiente na escala do problema fornecido
+        std::vector<double> minimoLinha; // Menor valor da soma das variáveis da forma canônica em cada restrição, dado pelos limites das folgas
+        std::vector<double> maximoLinha; // Maior valor da soma das variáveis da forma canônica em cada restrição
+        std::vector<bool> travaAbaixo; // Indica se diminuir a variável pode violar alguma restrição
+        std::vector<bool> travaAcima; // Indica se aumentar a variável pode violar alguma restrição
+        std::vector<double> custos; // Coeficiente de cada variável no objetivo interno, na escala do problema fornecido
+        double deslocamento; // Parcela do objetivo interno que não depende das variáveis da forma canônica
+        bool estimaObjetivo; // Indica se as folgas têm custo nulo, e o valor de uma candidata é calculado sem o Simplex
+
+        /**
+         * @brief Confirma uma candidata pelo Simplex dual e a oferece à incumbente
+         *
+         */
+
+        bool confirmaCandidata(const SimplexInteiro &problema, const std::vector<double> &candidata, Incumbente &incumbente) const;
+
+        /**
+         * @brief Calcula a soma das variáveis da forma canônica em cada restrição
+         *
+         */
+
+        std::vector<double> calculaAtividades(const std::vector<double> &valores) const;
+
+        /**
+         * @brief Calcula o valor de uma candidata no objetivo interno, ou infinito se as folgas têm custo e o valor depende delas
+         *
+         */
+
+        double calculaValor(const std::vector<double> &valores) const;
+
+    public:
+        /**
+         * @brief Monta as restrições por variável, os intervalos que as folgas permitem a cada restrição e o objetivo interno
+         *
+         * @param raiz O problema da raiz já resolvido, com os limites das variáveis
+         * @param numVars Número de variáveis na forma canônica
+         * @param restricoes As restrições do problema, na escala interna
+         * @param b O vetor de soluções das restrições
+         * @param c O vetor de coeficientes da função objetivo, na escala interna
+         */
+
+        Heuristicas(const SimplexInteiro &raiz, int numVars, const MatrizEsparsa &restricoes, const std::vector<double> &b, const std::vector<double> &c);
+
+        /**
+         * @brief Arredonda a solução de um nó. No arredondamento simples, cada coordenada fracionária vai para o lado em que nenhuma
+         * restrição pode ser violada. No arredondamento ZI, cada uma vai para o inteiro mais próximo que a folga das restrições permite,
+         * em passadas sucessivas, pois cada movimento altera as folgas das demais.
+         *
+         * @param problema O nó já resolvido
+         * @param solucao As coordenadas da solução do nó, na escala do problema fornecido
+         * @param zi true para o arredondamento ZI, false para o simples
+         * @param incumbente A solução incumbente
+         * @return true Se a incumbente melhorou
+         */
+
+        bool arredonda(const SimplexInteiro &problema, const std::vector<double> &solucao, bool zi, Incumbente &incumbente) const;
+
+        /**
+         * @brief Mergulha a partir de um nó, fixando uma variável fracionária de cada vez e reotimizando pelo Simplex dual, até uma solução
+         * inteira ou a inviabilidade. O mergulho fracionário arredonda a coordenada mais próxima de um inteiro, e o guiado, a mais próxima
+         * da incumbente, na direção dela. Se um arredondamento torna o nó inviável, o lado oposto é tentado uma vez.
+         *
+         * @param problema O nó já resolvido
+         * @param guiado true para o mergulho guiado, que exige uma incumbente
+         * @param incumbente A solução incumbente
+         * @return true Se a incumbente melhorou
+         */
+
+        bool mergulha(const SimplexInteiro &problema, bool guiado, Incumbente &incumbente) const;
+
+        /**
+         * @brief Bomba de viabilidade: alterna entre arredondar a solução da relaxação e resolver a relaxação com o objetivo de minimizar a
+         * distância ao arredondamento, medida nas variáveis que o arredondamento deixa em um dos seus limites. Quando o arredondamento
+         * se repete, as coordenadas mais distantes da relaxação trocam de lado.
+         *
+         * @param problema O nó já resolvido
+         * @param incumbente A solução incumbente
+         * @return true Se a incumbente melhorou
+         */
+
+        bool bombaViabilidade(const SimplexInteiro &problema, Incumbente &incumbente) const;
+};
+
+#endif
@@ -0,0 +1,56 @@
+#include <limits>
+
+#include "incumbente.hpp"
+
+Incumbente::Incumbente(int numVars) : valor(-std::numeric_limits<double>::infinity()), versao(0), numVars(numVars), numSolucoes(0)
+{
+    coordenadas.reset(new std::atomic<double>[numVars]);
+
+    for (int j = 0 ; j < numVars ; j++)
+        coordenadas[j].store(0, std::memory_order_relaxed);
+}
+
+bool Incumbente::atualiza(double novoValor, const std::vector<double> &solucao)
+{
+    std::lock_guard<std::mutex> trava(mutexEscrita);
+
+    if (valor.load(std::memory_order_relaxed) >= novoValor) // O objetivo interno é maximizado nos dois tipos de problema. Um empate não substitui a incumbente
+        return false;
+
+    unsigned long long v = versao.load(std::memory_order_relaxed);
+
+    versao.store(v + 1, std::memory_order_relaxed); // Ímpar: os leitores que copiarem agora repetem a leitura
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (int j = 0 ; j < numVars ; j++)
+        coordenadas[j].store(solucao[j], std::memory_order_relaxed);
+
+    valor.store(novoValor, std::memory_order_release); // Os testes de poda das demais threads passam a usar o novo valor
+    versao.store(v + 2, std::memory_order_release);
+    numSolucoes.fetch_add(1, std::memory_order_relaxed);
+
+    return true;
+}
+
+double Incumbente::leSolucao(std::vector<double> &solucao) const
+{
+    solucao.resize(numVars);
+
+    while (true)
+    {
+        unsigned long long antes = versao.load(std::memory_order_acquire);
+
+        if (antes % 2 != 0) // Escrita em andamento
+            continue;
+
+        for (int j = 0 ; j < numVars ; j++)
+            solucao[j] = coordenadas[j].load(std::memory_order_relaxed);
+
+        double lido = valor.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (versao.load(std::memory_order_relaxed) == antes)
+            return lido;
+    }
+}
@@ -0,0 +1,78 @@
+#ifndef INCUMBENTE_H
+#define INCUMBENTE_H
+
+/**
+ * @file incumbente.hpp
+ * @brief Arquivo contendo a classe Incumbente, a melhor solução inteira do Branch and Bound compartilhada entre as threads.
+ *
+ */
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Solução inteira incumbente, publicada sem travas para as leituras.
+ *
+ * O valor fica em um atômico, então os testes de poda o leem sem espera, e uma melhora fica visível para todas as threads
+ * assim que é publicada. As coordenadas são protegidas por um seqlock: a escrita torna a versão ímpar, grava e a torna par
+ * novamente, e a leitura copia as coordenadas e repete se a versão mudou ou era ímpar. As coordenadas são atômicas com ordem relaxada,
+ * para que a cópia concorrente com uma escrita não seja uma corrida de dados. Apenas as escritas, raras, são serializadas por um mutex.
+ */
+
+class Incumbente
+{
+    private:
+        std::atomic<double> valor; // Valor da solução no objetivo interno, ou -infinito sem solução
+        std::atomic<unsigned long long> versao; // Versão do seqlock das coordenadas, ímpar durante uma escrita
+        std::unique_ptr< std::atomic<double>[] > coordenadas; // As coordenadas da solução, inicialmente nulas
+        int numVars; // Número de coordenadas
+        std::atomic<int> numSolucoes; // Soluções que melhoraram a incumbente desde a criação
+        std::mutex mutexEscrita; // Mutex que serializa as escritas
+
+    public:
+        /**
+         * @brief Cria uma incumbente sem solução, com as coordenadas nulas
+         *
+         * @param numVars Número de variáveis na forma canônica
+         */
+
+        Incumbente(int numVars);
+
+        Incumbente(const Incumbente &) = delete;
+
+        Incumbente &operator=(const Incumbente &) = delete;
+
+        /**
+         * @brief Retorna o valor da incumbente sem travar
+         *
+         * @return double O valor no objetivo interno, ou -infinito se ainda não há solução
+         */
+
+        double getValor() const { return valor.load(std::memory_order_acquire); }
+
+        /**
+         * @brief Publica uma solução se ela é estritamente melhor que a incumbente
+         *
+         * @param novoValor O valor da solução no objetivo interno
+         * @param solucao As coordenadas da solução
+         * @return true Se a solução passou a ser a incumbente
+         * @return false Se a incumbente é melhor ou tem o mesmo valor
+         */
+
+        bool atualiza(double novoValor, const std::vector<double> &solucao);
+
+        /**
+         * @brief Copia a incumbente de forma consistente, mesmo durante uma escrita concorrente
+         *
+         * @param solucao Recebe as coordenadas
+         * @return double O valor correspondente às coordenadas, no objetivo interno
+         */
+
+        double leSolucao(std::vector<double> &solucao) const;
+
+        int getNumSolucoes() const { return numSolucoes.load(std::memory_order_relaxed); }
+};
+
+#endif
@@ -0,0 +1,217 @@
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <algorithm>
+
+#include "propagacao.hpp"
+
+static const double TOLERANCIA_PROPAGACAO = 1e-6; // Folga relativa dos testes de viabilidade e do arredondamento dos limites, contra o erro numérico
+static const double LIMITE_MAXIMO_PROPAGADO = 1e9; // Limites implicados maiores que esse valor, em módulo, não são aplicados
+static const int MAXIMO_VISITAS_LINHA = 10; // Visitas médias a cada restrição em uma propagação
+
+/**
+ * @brief Retorna a folga absoluta de um valor, relativa ao seu módulo
+ *
+ */
+
+static double tolerancia(double valor)
+{
+    return TOLERANCIA_PROPAGACAO * std::max(1.0, std::fabs(valor));
+}
+
+Propagacao::Propagacao(const SimplexInteiro &raiz, int numVars, const MatrizEsparsa &restricoes, const std::vector<double> &b)
+    : numVars(numVars), escalas(numVars), linhas(b.size()), colunas(numVars), minimoLinha(b), maximoLinha(b)
+{
+    for (int j = 0 ; j < numVars ; j++)
+        escalas[j] = raiz.getEscalaColuna(j);
+
+    for (int j = 0 ; j < restricoes.getColunas() ; j++)
+    {
+        for (int p = restricoes.inicioColuna(j) ; p < restricoes.fimColuna(j) ; p++)
+        {
+            int i = restricoes.linhaElemento(p);
+            double a = restricoes.valorElemento(p);
+
+            if (j < numVars)
+            {
+                linhas[i].push_back({j, a / escalas[j]});
+                colunas[j].push_back(i);
+                continue;
+            }
+
+            /* A folga ocupa o intervalo entre a vezes os seus limites, e a soma das demais variáveis é o lado direito menos ela */
+
+            double extremo1 = a * raiz.getLimiteInferior(j);
+            double extremo2 = a * raiz.getLimiteSuperior(j);
+
+            minimoLinha[i] -= std::max(extremo1, extremo2);
+            maximoLinha[i] -= std::min(extremo1, extremo2);
+        }
+    }
+}
+
+int Propagacao::propagaLinha(int i, std::vector<double> &inferiores, std::vector<double> &superiores, std::vector<int> &alteradas) const
+{
+    double minimo = 0, maximo = 0; // Parcelas finitas das atividades mínima e máxima
+    int infinitosMinimo = 0, infinitosMaximo = 0; // Variáveis sem limite na direção de cada atividade
+
+    for (const auto &elemento : linhas[i])
+    {
+        double paraMinimo = elemento.second > 0 ? inferiores[elemento.first] : superiores[elemento.first];
+        double paraMaximo = elemento.second > 0 ? superiores[elemento.first] : inferiores[elemento.first];
+
+        if (std::isinf(paraMinimo))
+            infinitosMinimo++;
+        else
+            minimo += elemento.second * paraMinimo;
+
+        if (std::isinf(paraMaximo))
+            infinitosMaximo++;
+        else
+            maximo += elemento.second * paraMaximo;
+    }
+
+    bool temMaximo = maximoLinha[i] != std::numeric_limits<double>::infinity();
+    bool temMinimo = minimoLinha[i] != -std::numeric_limits<double>::infinity();
+
+    if ((temMaximo && infinitosMinimo == 0 && minimo > maximoLinha[i] + tolerancia(maximoLinha[i])) ||
+        (temMinimo && infinitosMaximo == 0 && maximo < minimoLinha[i] - tolerancia(minimoLinha[i]))) // Nem os limites mais favoráveis atingem o intervalo
+        return -1;
+
+    int apertos = 0;
+
+    for (const auto &elemento : linhas[i])
+    {
+        int j = elemento.first;
+        double a = elemento.second;
+        double paraMinimo = a > 0 ? inferiores[j] : superiores[j];
+        double paraMaximo = a > 0 ? superiores[j] : inferiores[j];
+
+        /* Atividades das demais variáveis: conhecidas se nenhuma outra variável é ilimitada na direção */
+
+        double residuoMinimo = std::numeric_limits<double>::quiet_NaN();
+        double residuoMaximo = std::numeric_limits<double>::quiet_NaN();
+
+        if (infinitosMinimo == 0)
+            residuoMinimo = minimo - a * paraMinimo;
+        else if (infinitosMinimo == 1 && std::isinf(paraMinimo))
+            residuoMinimo = minimo;
+
+        if (infinitosMaximo == 0)
+            residuoMaximo = maximo - a * paraMaximo;
+        else if (infinitosMaximo == 1 && std::isinf(paraMaximo))
+            residuoMaximo = maximo;
+
+        /* a * x_j <= maximoLinha - residuoMinimo e a * x_j >= minimoLinha - residuoMaximo */
+
+        double novoInferior = inferiores[j], novoSuperior = superiores[j];
+
+        if (temMaximo && !std::isnan(residuoMinimo))
+        {
+            double implicado = (maximoLinha[i] - residuoMinimo) / a;
+
+            if (std::fabs(implicado) < LIMITE_MAXIMO_PROPAGADO)
+            {
+                if (a > 0)
+                    novoSuperior = std::min(novoSuperior, std::floor(implicado + tolerancia(implicado)));
+                else
+                    novoInferior = std::max(novoInferior, std::ceil(implicado - tolerancia(implicado)));
+            }
+        }
+
+        if (temMinimo && !std::isnan(residuoMaximo))
+        {
+            double implicado = (minimoLinha[i] - residuoMaximo) / a;
+
+            if (std::fabs(implicado) < LIMITE_MAXIMO_PROPAGADO)
+            {
+                if (a > 0)
+                    novoInferior = std::max(novoInferior, std::ceil(implicado - tolerancia(implicado)));
+                else
+                    novoSuperior = std::min(novoSuperior, std::floor(implicado + tolerancia(implicado)));
+            }
+        }
+
+        if (novoInferior == inferiores[j] && novoSuperior == superiores[j])
+            continue;
+
+        if (novoInferior > novoSuperior) // Nenhum valor inteiro da variável satisfaz a restrição
+            return -1;
+
+        /* As atividades da linha continuam calculadas com os limites anteriores, mais folgados, então os demais apertos continuam válidos */
+
+        inferiores[j] = novoInferior;
+        superiores[j] = novoSuperior;
+        alteradas.push_back(j);
+        apertos++;
+    }
+
+    return apertos;
+}
+
+int Propagacao::propaga(SimplexInteiro &no) const
+{
+    std::vector<double> inferiores(numVars), superiores(numVars); // Os limites das variáveis, na escala do problema fornecido
+
+    for (int j = 0 ; j < numVars ; j++)
+    {
+        inferiores[j] = no.getLimiteInferior(j) * escalas[j];
+        superiores[j] = no.getLimiteSuperior(j) * escalas[j];
+    }
+
+    std::queue<int> fila; // As restrições a visitar, inicialmente todas
+    std::vector<bool> naFila(linhas.size(), true);
+    std::vector<bool> alterada(numVars, false);
+    std::vector<int> alteradas; // As variáveis apertadas, na ordem do primeiro aperto
+    long long visitasRestantes = (long long) MAXIMO_VISITAS_LINHA * linhas.size();
+
+    for (int i = 0 ; i < (int) linhas.size() ; i++)
+        fila.push(i);
+
+    while (!fila.empty() && visitasRestantes-- > 0)
+    {
+        int i = fila.front();
+        std::vector<int> novas;
+
+        fila.pop();
+        naFila[i] = false;
+
+        if (propagaLinha(i, inferiores, superiores, novas) < 0)
+        {
+            no.declaraInviavel();
+            return -1;
+        }
+
+        for (int j : novas) // As restrições da variável apertada podem apertar outras
+        {
+            if (!alterada[j])
+            {
+                alterada[j] = true;
+                alteradas.push_back(j);
+            }
+
+            for (int k : colunas[j])
+            {
+                if (!naFila[k])
+                {
+                    naFila[k] = true;
+                    fila.push(k);
+                }
+            }
+        }
+    }
+
+    std::vector<AlteracaoLimite> apertos;
+
+    for (int j : alteradas) // Os limites que não mudaram são mantidos exatamente na escala interna
+    {
+        double inferior = inferiores[j] == no.getLimiteInferior(j) * escalas[j] ? no.getLimiteInferior(j) : inferiores[j] / escalas[j];
+        double superior = superiores[j] == no.getLimiteSuperior(j) * escalas[j] ? no.getLimiteSuperior(j) : superiores[j] / escalas[j];
+
+        apertos.push_back({j, inferior, superior});
+    }
+
+    no.aplicaAlteracoes(apertos);
+
+    return apertos.size();
+}
@@ -0,0 +1,66 @@
+#ifndef PROPAGACAO_H
+#define PROPAGACAO_H
+
+/**
+ * @file propagacao.hpp
+ * @brief Declaração da propagação dos limites das variáveis pelas restrições, aplicada em cada nó do Branch and Bound antes do Simplex dual.
+ *
+ */
+
+#include <vector>
+#include <utility>
+
+#include "simplex_inteiro.hpp"
+#include "../util/matriz_esparsa.hpp"
+
+/**
+ * @brief Propagação dos limites pelas atividades das restrições. Cada restrição limita a soma das variáveis da forma canônica a um
+ * intervalo, dado pelos limites das folgas. A menor e a maior atividade da restrição, calculadas pelos limites das variáveis, mostram
+ * se o intervalo ainda pode ser atingido e, descontada a parcela de uma variável, o quanto ela pode se mover. Como as variáveis são
+ * inteiras, os limites implicados são arredondados, e cada aperto vale ao menos uma unidade. As restrições das variáveis apertadas
+ * são revisitadas até que nada mude.
+ * A estrutura das restrições não é alterada após a construção, então a propagação pode ser aplicada por todas as threads ao mesmo tempo.
+ */
+
+class Propagacao
+{
+    private:
+        int numVars; // Número de variáveis da forma canônica, as inteiras
+        std::vector<double> escalas; // Fator de escala de cada variável da forma canônica
+        std::vector< std::vector< std::pair<int, double> > > linhas; // As variáveis da forma canônica de cada restrição, com o coeficiente na escala do problema fornecido
+        std::vector< std::vector<int> > colunas; // As restrições de cada variável da forma canônica
+        std::vector<double> minimoLinha; // Menor valor da soma das variáveis da forma canônica em cada restrição, dado pelos limites das folgas
+        std::vector<double> maximoLinha; // Maior valor da soma das variáveis da forma canônica em cada restrição
+
+        /**
+         * @brief Aperta os limites das variáveis de uma restrição pelas atividades mínima e máxima das demais
+         *
+         * @return int O número de limites apertados, ou -1 se a restrição não pode ser satisfeita
+         */
+
+        int propagaLinha(int i, std::vector<double> &inferiores, std::vector<double> &superiores, std::vector<int> &alteradas) const;
+
+    public:
+        /**
+         * @brief Monta as restrições por linha e por coluna e os intervalos que as folgas permitem a cada restrição
+         *
+         * @param raiz O problema da raiz, com os limites das folgas, que não mudam nos nós
+         * @param numVars Número de variáveis na forma canônica
+         * @param restricoes As restrições do problema, na escala interna
+         * @param b O vetor de soluções das restrições
+         */
+
+        Propagacao(const SimplexInteiro &raiz, int numVars, const MatrizEsparsa &restricoes, const std::vector<double> &b);
+
+        /**
+         * @brief Propaga os limites de um nó ainda não resolvido e aplica os apertos como limites alterados do nó, que passam aos filhos.
+         * Se uma restrição não pode ser satisfeita ou o intervalo de uma variável fica vazio, o nó é marcado como inviável sem o Simplex.
+         *
+         * @param no O nó
+         * @return int O número de variáveis com limites apertados, ou -1 se o nó é inviável
+         */
+
+        int propaga(SimplexInteiro &no) const;
+};
+
+#endif
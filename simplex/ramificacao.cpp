@@ -0,0 +1,260 @@
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <thread>
+
+#include "ramificacao.hpp"
+
+static const int MAXIMO_CANDIDATAS_FORTE = 8; // Candidatas avaliadas pela ramificação forte em cada nó
+static const int LIMITE_CONFIABILIDADE = 4; // Observações em cada direção a partir das quais o pseudo-custo de uma variável é confiável
+static const double PIORA_MINIMA = 1e-6; // Piora usada no produto quando a de um filho é nula, para que a do outro filho ainda desempate
+
+/**
+ * @brief Soma atômica em um double, que não tem fetch_add antes do C++20
+ *
+ */
+
+static void somaAtomica(std::atomic<double> &destino, double valor)
+{
+    double atual = destino.load(std::memory_order_relaxed);
+
+    while (!destino.compare_exchange_weak(atual, atual + valor, std::memory_order_relaxed))
+        ;
+}
+
+PseudoCustos::PseudoCustos(int numVars) : numVars(numVars)
+{
+    for (int d = 0 ; d < 2 ; d++)
+    {
+        somas[d].reset(new std::atomic<double>[numVars]);
+        contagens[d].reset(new std::atomic<int>[numVars]);
+
+        for (int j = 0 ; j < numVars ; j++)
+        {
+            somas[d][j].store(0, std::memory_order_relaxed);
+            contagens[d][j].store(0, std::memory_order_relaxed);
+        }
+
+        somaTotal[d].store(0, std::memory_order_relaxed);
+        contagemTotal[d].store(0, std::memory_order_relaxed);
+    }
+}
+
+void PseudoCustos::registra(int variavel, bool acima, double piora, double distancia)
+{
+    if (distancia <= 0 || variavel < 0 || variavel >= numVars)
+        return;
+
+    double porUnidade = std::max(piora, 0.0) / distancia;
+
+    somaAtomica(somas[acima][variavel], porUnidade);
+    contagens[acima][variavel].fetch_add(1, std::memory_order_relaxed);
+    somaAtomica(somaTotal[acima], porUnidade);
+    contagemTotal[acima].fetch_add(1, std::memory_order_relaxed);
+}
+
+double PseudoCustos::getPseudoCusto(int variavel, bool acima) const
+{
+    int observacoes = contagens[acima][variavel].load(std::memory_order_relaxed);
+
+    if (observacoes > 0)
+        return somas[acima][variavel].load(std::memory_order_relaxed) / observacoes;
+
+    int total = contagemTotal[acima].load(std::memory_order_relaxed);
+
+    if (total > 0)
+        return somaTotal[acima].load(std::memory_order_relaxed) / total;
+
+    return 1;
+}
+
+/**
+ * @brief Retorna a parte fracionária de cada coordenada fracionária, indexada pela coordenada. As coordenadas inteiras ficam fora.
+ *
+ */
+
+static std::vector< std::pair<int, double> > fracionarias(const std::vector<double> &solucao)
+{
+    std::vector< std::pair<int, double> > candidatas;
+
+    for (int j = 0 ; j < (int) solucao.size() ; j++)
+    {
+        if (!eInteiro(solucao[j]))
+            candidatas.push_back({j, solucao[j] - std::floor(solucao[j])});
+    }
+
+    return candidatas;
+}
+
+/**
+ * @brief Pontuação de uma candidata pelo produto das pioras dos dois filhos
+ *
+ */
+
+static double pontuacao(double pioraAbaixo, double pioraAcima)
+{
+    return std::max(pioraAbaixo, PIORA_MINIMA) * std::max(pioraAcima, PIORA_MINIMA);
+}
+
+int RamificacaoPrimeira::escolheVariavel(const SimplexInteiro &problema, const std::vector<double> &solucao, int numThreads)
+{
+    return retornaPosicaoNaoInteiro(solucao);
+}
+
+int RamificacaoFracionaria::escolheVariavel(const SimplexInteiro &problema, const std::vector<double> &solucao, int numThreads)
+{
+    int escolhida = -1;
+    double melhor = 0;
+
+    for (auto &candidata : fracionarias(solucao))
+    {
+        double distancia = std::min(candidata.second, 1 - candidata.second); // Distância ao inteiro mais próximo
+
+        if (escolhida == -1 || (maisFracionaria ? distancia > melhor : distancia < melhor))
+        {
+            escolhida = candidata.first;
+            melhor = distancia;
+        }
+    }
+
+    return escolhida;
+}
+
+int RamificacaoPseudoCusto::escolheVariavel(const SimplexInteiro &problema, const std::vector<double> &solucao, int numThreads)
+{
+    int escolhida = -1;
+    double melhor = -1;
+
+    for (auto &candidata : fracionarias(solucao))
+    {
+        int j = candidata.first;
+        double f = candidata.second;
+        double valor = pontuacao(pseudoCustos.getPseudoCusto(j, false) * f, pseudoCustos.getPseudoCusto(j, true) * (1 - f));
+
+        if (valor > melhor)
+        {
+            escolhida = j;
+            melhor = valor;
+        }
+    }
+
+    return escolhida;
+}
+
+/**
+ * @brief Resolve um filho de um nó sobre uma cópia do tableau do nó e registra a piora nos pseudo-custos
+ *
+ * @return double A piora do objetivo interno, ou infinito se o filho é inviável
+ */
+
+static double avaliaRamo(const SimplexInteiro &problema, const std::vector<double> &solucao, int j, bool acima, PseudoCustos &pseudoCustos)
+{
+    SimplexInteiro filho(problema);
+    double piso = std::floor(solucao[j]);
+    double f = solucao[j] - piso;
+
+    filho.adicionaRamificacao(j, acima ? piso + 1 : piso, !acima);
+    filho.aplicaSimplex({});
+
+    if (filho.getSemSolucao())
+        return std::numeric_limits<double>::infinity();
+
+    if (filho.getEIlimitado()) // Não ocorre a partir de um pai limitado, mas não indica piora
+        return 0;
+
+    double piora = std::max(problema.getSolucaoOtima() - filho.getSolucaoOtima(), 0.0);
+
+    pseudoCustos.registra(j, acima, piora, acima ? 1 - f : f);
+
+    return piora;
+}
+
+int RamificacaoForte::escolheVariavel(const SimplexInteiro &problema, const std::vector<double> &solucao, int numThreads)
+{
+    std::vector< std::pair<int, double> > candidatas = fracionarias(solucao);
+    std::vector<double> valores(candidatas.size()); // A pontuação de cada candidata
+    std::vector<int> avaliadas; // As posições em candidatas das que passam pela avaliação forte
+
+    for (int k = 0 ; k < (int) candidatas.size() ; k++)
+    {
+        int j = candidatas[k].first;
+        double f = candidatas[k].second;
+
+        valores[k] = pontuacao(pseudoCustos.getPseudoCusto(j, false) * f, pseudoCustos.getPseudoCusto(j, true) * (1 - f));
+
+        if (!confiabilidade || std::min(pseudoCustos.getObservacoes(j, false), pseudoCustos.getObservacoes(j, true)) < LIMITE_CONFIABILIDADE)
+            avaliadas.push_back(k);
+    }
+
+    /* A forte avalia as mais fracionárias, e a de confiabilidade, as não confiáveis de maior pseudo-custo */
+
+    auto prioridade = [&](int k){ return confiabilidade ? valores[k] : std::min(candidatas[k].second, 1 - candidatas[k].second); };
+
+    std::stable_sort(avaliadas.begin(), avaliadas.end(), [&](int k1, int k2){ return prioridade(k1) > prioridade(k2); });
+
+    if ((int) avaliadas.size() > MAXIMO_CANDIDATAS_FORTE)
+        avaliadas.resize(MAXIMO_CANDIDATAS_FORTE);
+
+    auto avalia = [&](int inicio, int passo)
+    {
+        for (int i = inicio ; i < (int) avaliadas.size() ; i += passo)
+        {
+            int k = avaliadas[i];
+            int j = candidatas[k].first;
+
+            valores[k] = pontuacao(avaliaRamo(problema, solucao, j, false, pseudoCustos), avaliaRamo(problema, solucao, j, true, pseudoCustos));
+        }
+    };
+
+    int numAvaliadoras = std::max(1, std::min(numThreads, (int) avaliadas.size()));
+
+    if (numAvaliadoras == 1)
+        avalia(0, 1);
+
+    else // Cada thread avalia as candidatas de posição congruente ao seu índice. As pontuações são escritas em posições distintas
+    {
+        std::vector<std::thread> avaliadoras;
+
+        for (int t = 0 ; t < numAvaliadoras ; t++)
+            avaliadoras.push_back(std::thread(avalia, t, numAvaliadoras));
+
+        for (auto &avaliadora : avaliadoras)
+            avaliadora.join();
+    }
+
+    int escolhida = -1;
+    double melhor = -1;
+
+    for (int k = 0 ; k < (int) candidatas.size() ; k++)
+    {
+        if (!confiabilidade && std::find(avaliadas.begin(), avaliadas.end(), k) == avaliadas.end()) // A forte pura escolhe apenas entre as avaliadas
+            continue;
+
+        if (valores[k] > melhor)
+        {
+            escolhida = candidatas[k].first;
+            melhor = valores[k];
+        }
+    }
+
+    return escolhida;
+}
+
+std::unique_ptr<EstrategiaRamificacao> criaEstrategiaRamificacao(RegraRamificacao regra, PseudoCustos &pseudoCustos)
+{
+    switch (regra)
+    {
+        case RegraRamificacao::MAIS_FRACIONARIA:
+            return std::unique_ptr<EstrategiaRamificacao>(new RamificacaoFracionaria(true));
+        case RegraRamificacao::MENOS_FRACIONARIA:
+            return std::unique_ptr<EstrategiaRamificacao>(new RamificacaoFracionaria(false));
+        case RegraRamificacao::PSEUDOCUSTO:
+            return std::unique_ptr<EstrategiaRamificacao>(new RamificacaoPseudoCusto(pseudoCustos));
+        case RegraRamificacao::FORTE:
+            return std::unique_ptr<EstrategiaRamificacao>(new RamificacaoForte(pseudoCustos, false));
+        case RegraRamificacao::CONFIABILIDADE:
+            return std::unique_ptr<EstrategiaRamificacao>(new RamificacaoForte(pseudoCustos, true));
+        default:
+            return std::unique_ptr<EstrategiaRamificacao>(new RamificacaoPrimeira());
+    }
+}
@@ -0,0 +1,169 @@
+#ifndef RAMIFICACAO_H
+#define RAMIFICACAO_H
+
+/**
+ * @file ramificacao.hpp
+ * @brief Declaração das estratégias de ramificação, que escolhem a variável fracionária em que um nó do Branch and Bound é dividido.
+ *
+ */
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "simplex_inteiro.hpp"
+#include "../util/configuracao.hpp"
+
+/**
+ * @brief Pseudo-custos de cada variável: a piora média do objetivo por unidade de distância ao novo limite, em cada direção.
+ *
+ * As observações vêm dos filhos resolvidos por todas as threads e das avaliações da ramificação forte. Os contadores e as somas
+ * são atômicos, então o registro e a leitura não travam. Uma leitura concorrente com um registro pode combinar a soma antiga
+ * com a contagem nova, o que apenas perturba a média momentaneamente.
+ */
+
+class PseudoCustos
+{
+    private:
+        int numVars; // Número de variáveis
+        std::unique_ptr< std::atomic<double>[] > somas[2]; // Soma das pioras por unidade de cada variável, para baixo [0] e para cima [1]
+        std::unique_ptr< std::atomic<int>[] > contagens[2]; // Número de observações de cada variável em cada direção
+        std::atomic<double> somaTotal[2]; // Soma de todas as observações em cada direção, para o pseudo-custo das variáveis sem observações
+        std::atomic<int> contagemTotal[2]; // Número de todas as observações em cada direção
+
+    public:
+        /**
+         * @brief Cria os pseudo-custos sem observações
+         *
+         * @param numVars Número de variáveis na forma canônica
+         */
+
+        PseudoCustos(int numVars);
+
+        PseudoCustos(const PseudoCustos &) = delete;
+
+        PseudoCustos &operator=(const PseudoCustos &) = delete;
+
+        /**
+         * @brief Registra a piora do objetivo ao ramificar uma variável
+         *
+         * @param variavel A variável ramificada
+         * @param acima true se é o ramo x >= teto, false se é o ramo x <= piso
+         * @param piora A piora do objetivo interno, não negativa
+         * @param distancia A distância do valor da variável no pai ao novo limite
+         */
+
+        void registra(int variavel, bool acima, double piora, double distancia);
+
+        /**
+         * @brief Retorna o número de observações de uma variável em uma direção
+         *
+         */
+
+        int getObservacoes(int variavel, bool acima) const { return contagens[acima][variavel].load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Retorna o pseudo-custo de uma variável em uma direção. Sem observações, usa a média das variáveis já observadas, ou 1.
+         *
+         */
+
+        double getPseudoCusto(int variavel, bool acima) const;
+};
+
+/**
+ * @brief Interface das estratégias de ramificação.
+ *
+ * A estratégia é compartilhada por todas as threads, então escolheVariavel pode ser chamada concorrentemente e não deve alterar o nó.
+ */
+
+class EstrategiaRamificacao
+{
+    public:
+        virtual ~EstrategiaRamificacao() = default;
+
+        /**
+         * @brief Escolhe a variável a ser ramificada
+         *
+         * @param problema O nó já resolvido
+         * @param solucao As coordenadas da solução do nó, na escala do problema fornecido. Ao menos uma é fracionária
+         * @param numThreads Número de threads que podem avaliar candidatas ao mesmo tempo, usado apenas pela ramificação forte
+         * @return int O índice da variável escolhida
+         */
+
+        virtual int escolheVariavel(const SimplexInteiro &problema, const std::vector<double> &solucao, int numThreads) = 0;
+};
+
+/**
+ * @brief A primeira coordenada fracionária, a regra original do programa.
+ *
+ */
+
+class RamificacaoPrimeira : public EstrategiaRamificacao
+{
+    public:
+        int escolheVariavel(const SimplexInteiro &problema, const std::vector<double> &solucao, int numThreads) override;
+};
+
+/**
+ * @brief A coordenada com parte fracionária mais próxima de 0,5 ou, na regra menos fracionária, mais próxima de um inteiro.
+ * Em caso de empate, a primeira.
+ *
+ */
+
+class RamificacaoFracionaria : public EstrategiaRamificacao
+{
+    private:
+        bool maisFracionaria; // true para a mais fracionária, false para a menos fracionária
+
+    public:
+        explicit RamificacaoFracionaria(bool maisFracionaria) : maisFracionaria(maisFracionaria) {}
+
+        int escolheVariavel(const SimplexInteiro &problema, const std::vector<double> &solucao, int numThreads) override;
+};
+
+/**
+ * @brief Ramificação por pseudo-custos: maximiza o produto das pioras estimadas dos dois filhos.
+ *
+ */
+
+class RamificacaoPseudoCusto : public EstrategiaRamificacao
+{
+    protected:
+        PseudoCustos &pseudoCustos; // Os pseudo-custos compartilhados
+
+    public:
+        explicit RamificacaoPseudoCusto(PseudoCustos &pseudoCustos) : pseudoCustos(pseudoCustos) {}
+
+        int escolheVariavel(const SimplexInteiro &problema, const std::vector<double> &solucao, int numThreads) override;
+};
+
+/**
+ * @brief Ramificação forte: resolve os dois filhos de cada candidata e escolhe a de maior produto das pioras.
+ * Um filho inviável torna a candidata a melhor possível, já que o filho será podado sem ramificar.
+ * Na ramificação forte pura, as candidatas são as mais fracionárias. Na de confiabilidade, apenas as variáveis com menos observações
+ * que o limite de confiabilidade são avaliadas, em ordem de pseudo-custo, e as demais usam o pseudo-custo.
+ * As avaliações alimentam os pseudo-custos.
+ */
+
+class RamificacaoForte : public RamificacaoPseudoCusto
+{
+    private:
+        bool confiabilidade; // true para a ramificação por confiabilidade
+
+    public:
+        RamificacaoForte(PseudoCustos &pseudoCustos, bool confiabilidade) : RamificacaoPseudoCusto(pseudoCustos), confiabilidade(confiabilidade) {}
+
+        int escolheVariavel(const SimplexInteiro &problema, const std::vector<double> &solucao, int numThreads) override;
+};
+
+/**
+ * @brief Cria a estratégia de ramificação da regra fornecida
+ *
+ * @param regra A regra
+ * @param pseudoCustos Os pseudo-custos, usados pelas regras que dependem deles
+ * @return std::unique_ptr<EstrategiaRamificacao> A estratégia
+ */
+
+std::unique_ptr<EstrategiaRamificacao> criaEstrategiaRamificacao(RegraRamificacao regra, PseudoCustos &pseudoCustos);
+
+#endif
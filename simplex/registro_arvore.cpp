@@ -0,0 +1,80 @@
+#include "registro_arvore.hpp"
+
+static const std::size_t TAMANHO_BLOCO = 256; // Registros acumulados por uma thread antes da gravação
+
+RegistroArvore::RegistroArvore() : arquivo(nullptr), falhou(false)
+{
+
+}
+
+RegistroArvore::~RegistroArvore()
+{
+    if (arquivo)
+        std::fclose(arquivo);
+}
+
+bool RegistroArvore::abre(const std::string &caminho, int numThreads)
+{
+    if (arquivo)
+        std::fclose(arquivo);
+
+    arquivo = caminho.empty() ? std::tmpfile() : std::fopen(caminho.c_str(), "w+b");
+    falhou = false;
+    blocos.assign(numThreads, {});
+
+    for (auto &bloco : blocos)
+        bloco.reserve(TAMANHO_BLOCO);
+
+    return arquivo != nullptr;
+}
+
+void RegistroArvore::gravaBloco(std::vector<RegistroNo> &bloco)
+{
+    std::lock_guard<std::mutex> trava(mutexArquivo);
+
+    if (std::fwrite(bloco.data(), sizeof(RegistroNo), bloco.size(), arquivo) != bloco.size())
+        falhou = true;
+
+    bloco.clear();
+}
+
+void RegistroArvore::registra(int trabalhador, const RegistroNo &registro)
+{
+    std::vector<RegistroNo> &bloco = blocos[trabalhador];
+
+    bloco.push_back(registro);
+
+    if (bloco.size() >= TAMANHO_BLOCO)
+        gravaBloco(bloco);
+}
+
+bool RegistroArvore::percorreRegistros(const std::function<void(const RegistroNo &)> &visita)
+{
+    if (!arquivo)
+        return false;
+
+    for (auto &bloco : blocos)
+    {
+        if (!bloco.empty())
+            gravaBloco(bloco);
+    }
+
+    if (std::fflush(arquivo) != 0 || std::fseek(arquivo, 0, SEEK_SET) != 0)
+        return false;
+
+    /* Os registros saem na ordem de gravação dos blocos, que segue o encerramento dos nós em cada thread, e não na ordem dos identificadores */
+
+    std::vector<RegistroNo> bloco(TAMANHO_BLOCO);
+    std::size_t lidos;
+
+    while ((lidos = std::fread(bloco.data(), sizeof(RegistroNo), bloco.size(), arquivo)) > 0)
+    {
+        for (std::size_t i = 0 ; i < lidos ; i++)
+            visita(bloco[i]);
+    }
+
+    if (std::ferror(arquivo))
+        falhou = true;
+
+    return !falhou;
+}
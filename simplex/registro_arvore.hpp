@@ -0,0 +1,97 @@
+#ifndef REGISTRO_ARVORE_H
+#define REGISTRO_ARVORE_H
+
+/**
+ * @file registro_arvore.hpp
+ * @brief Arquivo contendo a classe RegistroArvore, que grava em arquivo um registro compacto de cada nó encerrado do Branch and Bound.
+ *
+ */
+
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Registro de tamanho fixo de um nó encerrado, gravado no arquivo como está.
+ *
+ */
+
+typedef struct
+{
+    int idProblema; // Identificador do nó
+    int idPai; // Identificador do pai, 0 nos filhos da raiz
+    int variavel; // Variável ramificada neste nó, -1 se o nó foi podado
+    int divisoes[2]; // Filhos do nó, se ele ramificou
+    short int tipoPoda; // O tipo de poda, como em SimplexInteiro
+    bool resolvido; // false se o nó é inviável, ilimitado ou foi descartado sem resolução
+    double limite; // Piso do valor da variável ramificada, na escala do problema fornecido: o primeiro filho tem x <= limite e o segundo, x >= limite + 1
+    double valor; // Valor da relaxação linear do nó, no objetivo interno
+} RegistroNo;
+
+/**
+ * @brief Registro dos nós encerrados do Branch and Bound em um arquivo binário, em vez da memória.
+ *
+ * Cada thread acumula os seus registros em um bloco próprio, gravado no arquivo sob um mutex quando fica cheio,
+ * então a memória usada não cresce com o tamanho da árvore e as threads raramente disputam o arquivo.
+ * A leitura final também percorre o arquivo em blocos, na ordem de gravação, sem carregar todos os registros.
+ * Sem um caminho, o arquivo é temporário e removido ao fim do programa.
+ */
+
+class RegistroArvore
+{
+    private:
+        std::FILE *arquivo; // O arquivo dos registros, ou nulo se não foi aberto
+        std::mutex mutexArquivo; // Mutex para a gravação dos blocos
+        std::vector< std::vector<RegistroNo> > blocos; // Registros de cada thread ainda não gravados
+        bool falhou; // Indica se alguma gravação falhou
+
+        /**
+         * @brief Grava um bloco no arquivo e o esvazia
+         *
+         */
+
+        void gravaBloco(std::vector<RegistroNo> &bloco);
+
+    public:
+        RegistroArvore();
+
+        ~RegistroArvore();
+
+        RegistroArvore(const RegistroArvore &) = delete;
+
+        RegistroArvore &operator=(const RegistroArvore &) = delete;
+
+        /**
+         * @brief Cria o arquivo do registro, descartando um registro anterior
+         *
+         * @param caminho O caminho do arquivo. Vazio cria um arquivo temporário
+         * @param numThreads O número de threads que registram nós
+         * @return true Se o arquivo foi criado
+         * @return false Caso contrário
+         */
+
+        bool abre(const std::string &caminho, int numThreads);
+
+        /**
+         * @brief Registra um nó encerrado. Cada thread usa apenas o seu índice, então não há disputa fora da gravação dos blocos.
+         *
+         * @param trabalhador O índice da thread
+         * @param registro O registro do nó
+         */
+
+        void registra(int trabalhador, const RegistroNo &registro);
+
+        /**
+         * @brief Grava os blocos restantes e percorre os registros do arquivo na ordem de gravação, um bloco por vez. Deve ser chamada após o fim das threads.
+         *
+         * @param visita Função chamada com cada registro lido
+         * @return true Se todos os registros foram gravados e lidos
+         * @return false Se o registro está incompleto
+         */
+
+        bool percorreRegistros(const std::function<void(const RegistroNo &)> &visita);
+};
+
+#endif
@@ -4,24 +4,53 @@
 #include <iterator>
 #include <limits>
 #include <algorithm>
+#include <utility>
+#include <stdexcept>
+#include <random>
 
 #include "../util/preparador.hpp"
+#include "../util/vetorizacao.hpp"
 #include "simplex.hpp"
 
-Simplex::Simplex (std::vector <std::vector<double>> coeficientes, std::vector<double> b, std::vector<double> c, bool tipoProblema, bool eDuasFases, int numVarArtificiais, int numVars)
+static const double TOLERANCIA_HARRIS = TOLERANCIA_VIABILIDADE / 2; // Relaxação dos limites na primeira passagem do teste de Harris
+static const double TOLERANCIA_EMPATE = 1e-12; // Razões com diferença abaixo desse valor são consideradas empatadas na regra de Bland
+static const double TOLERANCIA_PROGRESSO = 1e-12; // Aumento relativo mínimo do objetivo para que a iteração não seja considerada degenerada
+
+Simplex::Simplex (Matriz coeficientes, std::vector<double> b, std::vector<double> c, bool tipoProblema, bool eDuasFases, int numVarArtificiais, int numVars)
+    : Simplex(coeficientes.getLinhas(), coeficientes.getColunas(), b, c, tipoProblema, eDuasFases, numVarArtificiais, numVars)
+{
+    A = std::move(coeficientes); // Inicializa a matriz A.
+}
+
+Simplex::Simplex (int linhas, int colunas, std::vector<double> b, std::vector<double> c, bool tipoProblema, bool eDuasFases, int numVarArtificiais, int numVars)
 {
     solucaoOtima = solucaoOtimaPrimeiraFase = 0;
+    constanteObjetivo = 0;
     eIlimitado = false;
     semSolucao = false;
     this->eDuasFases = eDuasFases;
     this->numVarArtificiais = numVarArtificiais;
     this->numVars = numVars;
-    linhas = coeficientes.size();
+    this->linhas = linhas;
     this->tipoProblema = tipoProblema;
-    colunas = coeficientes[0].size(); // O tamanho de uma linha indica o número de variáveis no problema.
+    this->colunas = colunas; // O tamanho de uma linha indica o número de variáveis no problema.
     
     B.assign(b.begin(), b.end()); // Inicializa o vetor B.
 
+    limiteInferior.assign(colunas, 0); // Inicialmente, todas as variáveis estão em [0, infinito)
+    limiteSuperior.assign(colunas, std::numeric_limits<double>::infinity());
+    naSuperior.assign(colunas, false);
+    temLimites = false;
+
+    usaHarris = true;
+    limiteSemProgresso = 50;
+    perturbaB = false;
+    perturbacaoObjetivo = 0;
+    limiteObjetivo = -std::numeric_limits<double>::infinity();
+    objetivoCortado = false;
+    modoBland = false;
+    reiniciaProgresso();
+
     if (tipoProblema) // Se o problema for de maximização, basta copiar o vetor C e setar a booleana.
     {
         C.assign(c.begin(), c.end());
@@ -40,11 +69,7 @@ Simplex::Simplex (std::vector <std::vector<double>> coeficientes, std::vector<do
         
         eMaximizacao = false;
     }
-    
-    for (int i = 0 ; i < linhas ; i++)
-        A.push_back(coeficientes[i]); // Inicializa a matriz A.
 
-    
     if (!eDuasFases) // Se o método tem primeira fase, a função iniciaPrimeiraFase trata as bases
     {
         int j = 0;
@@ -65,20 +90,34 @@ Simplex::Simplex (std::vector <std::vector<double>> coeficientes, std::vector<do
 
 bool Simplex::calculaIteracaoSimplex(int iteracao)
 {
-    if (verificarSolucaoOtima())
-        return true;
-
-    int colunaNumPivo = achaColunaPivo();
+    if (temLimites) // O teste da razão tradicional supõe todas as variáveis em [0, infinito)
+    {
+        if (!realizaIteracaoComLimites())
+        {
+            if (eIlimitado)
+                imprimeInformacao("Solução ilimitada.\n\n");
 
-    int linhaPivo = achaLinhaPivo(colunaNumPivo);
+            return true;
+        }
+    }
 
-    if (eIlimitado)
+    else
     {
-        imprimeInformacao("Solução ilimitada.\n\n");
-        return true;
-    }
+        int colunaNumPivo = achaColunaPivo();
+
+        if (colunaNumPivo == -1) // Não há coeficiente negativo na função objetivo, a solução é ótima
+            return true;
 
-    realizaPivoteamento(linhaPivo, colunaNumPivo);
+        int linhaPivo = achaLinhaPivo(colunaNumPivo);
+
+        if (eIlimitado)
+        {
+            imprimeInformacao("Solução ilimitada.\n\n");
+            return true;
+        }
+
+        realizaPivoteamento(linhaPivo, colunaNumPivo);
+    }
 
     if (semSolucao)
     {
@@ -140,38 +179,6 @@ bool Simplex::calculaIteracaoSimplex(int iteracao)
     return false;
 }
 
-bool Simplex::verificarSolucaoOtima()
-{
-    bool eOtima = false;
-    int contagemNumPositivos = 0;
-
-    if (eDuasFases)
-    {
-        for (int i = 0 ; i < (int) C_artificial.size() ; i++)
-        {
-            if (ceil(C_artificial[i] * 10000000000)/ 10000000000 >= 0)
-                contagemNumPositivos++;
-        }
-
-        if (contagemNumPositivos == (int) C_artificial.size())
-            eOtima = true;
-    }
-
-    else
-    {
-        for (int i = 0 ; i < (int) C.size() ; i++)
-        {
-            if (ceil(C[i] * 10000000000)/ 10000000000 >= 0)
-                contagemNumPositivos++;
-        }
-
-        if (contagemNumPositivos == (int) C.size())
-            eOtima = true;
-    }   
-
-    return eOtima;
-}
-
 void Simplex::realizaPivoteamento(int linhaPivo, int colunaNumPivo)
 {
     double numPivo = A[linhaPivo][colunaNumPivo];
@@ -181,13 +188,7 @@ void Simplex::realizaPivoteamento(int linhaPivo, int colunaNumPivo)
 
     solucaoOtima = solucaoOtima - (C[colunaNumPivo] * (B[linhaPivo] / numPivo));
 
-    if (!(std::fabs(numPivo - 1) <= std::numeric_limits<double>::epsilon()))
-    {
-        for (int k = 0 ; k < colunas ; k++)
-            A[linhaPivo][k] = A[linhaPivo][k] / numPivo; // Divide a linha pivô pelo número pivô.
-    }    
-
-    B[linhaPivo] = B[linhaPivo] / numPivo; // O vetor B está separado, realiza a mesma ação anterior.
+    B[linhaPivo] = B[linhaPivo] / numPivo; // O vetor B está separado, realiza a mesma ação da divisão da linha pivô.
 
     base[linhaPivo] = {colunaNumPivo, B[linhaPivo]};  // Altera a base correspondente a essa linha.
 
@@ -199,20 +200,57 @@ void Simplex::realizaPivoteamento(int linhaPivo, int colunaNumPivo)
 
             if (multiplicadorLinha == 0)
             {
-                if (B[i] < 0) // Se algum B[i] é menor que 0, o problema é inviável.
+                if (B[i] < -TOLERANCIA_VIABILIDADE) // Se algum B[i] é menor que 0, o problema é inviável.
                     semSolucao = true;
                 continue;
             }
 
             B[i] = B[i] - (multiplicadorLinha * B[linhaPivo]); // Atualiza o B_i
 
-            if (B[i] < 0)
+            if (B[i] < -TOLERANCIA_VIABILIDADE)
                 semSolucao = true;
 
             base[i] = {base[i].first, B[i]}; // Atualiza no vetor de bases o valor de B_i.
         }
     } 
 
+    pivoteiaTableau(linhaPivo, colunaNumPivo);
+}
+
+void Simplex::pivoteiaTableau(int linhaPivo, int colunaNumPivo)
+{
+    if (precificacao->usaLinhaPivo()) // Os pesos da precificação dependem do tableau antes do pivoteamento
+        atualizaPrecificacao(linhaPivo, colunaNumPivo);
+
+    if (precificacao->numPesosLinhas() == linhas) // Os pesos das linhas acompanham também os pivoteamentos do primal, depois do primeiro Simplex dual
+        atualizaPesosLinhas(linhaPivo, colunaNumPivo);
+
+    double numPivo = A[linhaPivo][colunaNumPivo];
+
+    if (!perturbacao.empty()) // A perturbação é transformada como uma coluna a mais do tableau, para ser removida ao final
+    {
+        perturbacao[linhaPivo] /= numPivo;
+
+        for (int i = 0 ; i < linhas ; i++)
+        {
+            if (i != linhaPivo)
+                perturbacao[i] -= A[i][colunaNumPivo] * perturbacao[linhaPivo];
+        }
+
+        perturbacaoObjetivo -= C[colunaNumPivo] * perturbacao[linhaPivo];
+    }
+
+    if (!(std::fabs(numPivo - 1) <= std::numeric_limits<double>::epsilon()))
+        divideVetor(A[linhaPivo], numPivo, colunas); // Divide a linha pivô pelo número pivô.
+
+    naoNulosLinhaPivo.clear();
+
+    for (int j = 0 ; j < colunas ; j++) // Em problemas esparsos, a linha pivô costuma ter poucos elementos não nulos
+    {
+        if (A[linhaPivo][j] != 0)
+            naoNulosLinhaPivo.push_back(j);
+    }
+
     for (int m = 0 ; m < linhas ; m++)
     {
         double multiplicadorLinha = A[m][colunaNumPivo]; // Capturamos o elemento que faz zerar o elemento da coluna pivô dessa linha.
@@ -221,34 +259,44 @@ void Simplex::realizaPivoteamento(int linhaPivo, int colunaNumPivo)
             continue;
 
         if (m != linhaPivo)
-        {
-            for (int p = 0 ; p < colunas ; p++)                        
-                A[m][p] = A[m][p] - (multiplicadorLinha * A[linhaPivo][p]);  // Atualiza cada elemento da linha, realizando o pivoteamento.                 
-        }
+            subtraiLinhaPivo(A[m], linhaPivo, multiplicadorLinha, colunas); // Atualiza cada elemento da linha, realizando o pivoteamento.
     }
 
     /* Processo análogo para o vetor de coeficientes da função objetivo. */    
     double multiplicadorLinha = C[colunaNumPivo];
 
     if (multiplicadorLinha != 0)
-    {
-        for (int i = 0 ; i < colunas ; i++)
-            C[i] = C[i] - (multiplicadorLinha * A[linhaPivo][i]);
-    }    
+        subtraiLinhaPivo(C.data(), linhaPivo, multiplicadorLinha, colunas);
 
     if (eDuasFases) // Se estamos na primeira fase, é necessário trabalhar com a função objetivo artificial.
     {
         multiplicadorLinha = C_artificial[colunaNumPivo];
 
         if (multiplicadorLinha != 0)
-        {
-            for (int i = 0 ; i < (int) C_artificial.size() ; i++)
-                C_artificial[i] = C_artificial[i] - (multiplicadorLinha * A[linhaPivo][i]);
-        }        
+            subtraiLinhaPivo(C_artificial.data(), linhaPivo, multiplicadorLinha, C_artificial.size());
     }
 }
 
-void Simplex::printMatrizes()
+void Simplex::subtraiLinhaPivo(double *destino, int linhaPivo, double multiplicador, int n)
+{
+    /*
+    * Com menos de um quarto de elementos não nulos, a atualização indexada é mais rápida que a vetorizada.
+    * Os elementos nulos da linha pivô não alteram o destino, então o resultado é o mesmo nos dois casos.
+    */
+
+    if ((int) naoNulosLinhaPivo.size() * 4 >= n)
+    {
+        subtraiMultiplo(destino, A[linhaPivo], multiplicador, n);
+        return;
+    }
+
+    const double *pivo = A[linhaPivo];
+
+    for (int j : naoNulosLinhaPivo)
+        destino[j] -= multiplicador * pivo[j];
+}
+
+void Simplex::printMatrizA()
 {
     std::cout << "Matriz A: \n";
 
@@ -258,6 +306,11 @@ void Simplex::printMatrizes()
             std::cout << A[i][j] << " | ";
         std::cout << std::endl;
     }
+}
+
+void Simplex::printMatrizes()
+{
+    printMatrizA();
 
     std::cout << "Vetor B: \n";
     for (int i = 0 ; i < (int) B.size() ; i++)
@@ -281,72 +334,214 @@ void Simplex::printMatrizes()
 
 int Simplex::achaColunaPivo()
 {
-    /* Inicializamos tomando a primeira posição como o menor elemento */
-
-    int localizacao = 0;
-    double menor;
+    /* Com a regra de Dantzig, procura o coeficiente mais negativo. Em caso de empate, a última ocorrência é escolhida. */
 
     if (eDuasFases)
+        return escolheColunaEntrada(C_artificial.data(), C_artificial.size());
+
+    return escolheColunaEntrada(C.data(), C.size());
+}
+
+int Simplex::escolheColunaEntrada(const double *custos, int n)
+{
+    registraProgresso();
+
+    if (!modoBland)
+        return precificacao->escolheColuna(custos, n);
+
+    for (int j = 0 ; j < n ; j++) // Regra de Bland: a variável de menor índice com custo negativo
     {
-        menor = C_artificial[0];
+        if (eCustoNegativo(custos[j]))
+            return j;
+    }
+
+    return -1;
+}
 
-        for (int i = 1 ; i < (int) C_artificial.size() ; i++) // Realiza um procedimento comum para encontrar o menor
+void Simplex::reiniciaProgresso()
+{
+    iteracoesSemProgresso = 0;
+    ultimoObjetivo = -std::numeric_limits<double>::infinity();
+    modoBland = false;
+}
+
+void Simplex::registraProgresso()
+{
+    double objetivo = eDuasFases ? solucaoOtimaPrimeiraFase : solucaoOtima; // O objetivo interno sempre cresce
+
+    if (objetivo > ultimoObjetivo + TOLERANCIA_PROGRESSO * (1 + std::fabs(ultimoObjetivo)))
+    {
+        iteracoesSemProgresso = 0;
+        modoBland = false; // O objetivo voltou a crescer, retomamos a precificação escolhida
+    }
+
+    else if (++iteracoesSemProgresso >= limiteSemProgresso && !modoBland)
+    {
+        modoBland = true;
+        imprimeInformacao("Sem progresso em " + std::to_string(iteracoesSemProgresso) + " iterações. Aplicando a regra de Bland.\n\n");
+    }
+
+    ultimoObjetivo = objetivo;
+}
+
+int Simplex::escolheLinhaRazao(const std::vector<double> &coluna)
+{
+    /* A coluna já deve conter apenas os coeficientes acima de TOLERANCIA_PIVO; os demais são nulos. */
+
+    int escolhida = -1;
+
+    if (modoBland) // Menor razão, com empates decididos pela variável básica de menor índice
+    {
+        double menorRazao = std::numeric_limits<double>::infinity();
+
+        for (int i = 0 ; i < linhas ; i++)
         {
-            if (C_artificial[i] <= menor)
+            if (coluna[i] <= 0)
+                continue;
+
+            double razao = std::max(B[i], 0.0) / coluna[i];
+
+            if (escolhida == -1 || razao < menorRazao - TOLERANCIA_EMPATE
+                || (razao <= menorRazao + TOLERANCIA_EMPATE && base[i].first < base[escolhida].first))
             {
-                menor = C_artificial[i];
-                localizacao = i;
+                menorRazao = std::min(menorRazao, razao);
+                escolhida = i;
             }
         }
+
+        return escolhida;
     }
 
-    else
+    if (!usaHarris)
+        return indiceMenorRazao(B.data(), coluna.data(), linhas);
+
+    double limiteHarris = std::numeric_limits<double>::infinity();
+
+    for (int i = 0 ; i < linhas ; i++) // Primeira passagem: menor razão com os valores básicos relaxados pela tolerância
     {
-        menor = C[0];
+        if (coluna[i] > 0)
+            limiteHarris = std::min(limiteHarris, (B[i] + TOLERANCIA_HARRIS) / coluna[i]);
+    }
 
-        for (int i = 1 ; i < (int) C.size() ; i++) // Realiza um procedimento comum para encontrar o menor
+    double maiorPivo = 0;
+
+    for (int i = 0 ; i < linhas ; i++) // Segunda passagem: entre as razões dentro do limite, o maior pivô. Em caso de empate, a última linha
+    {
+        if (coluna[i] > 0 && B[i] / coluna[i] <= limiteHarris && coluna[i] >= maiorPivo)
         {
-            if (C[i] <= menor)
-            {
-                menor = C[i];
-                localizacao = i;
-            }
+            maiorPivo = coluna[i];
+            escolhida = i;
         }
-    }    
+    }
 
-    return localizacao;
+    return escolhida;
 }
 
-int Simplex::achaLinhaPivo(int colunaNumPivo)
+void Simplex::iniciaPrecificacao()
+{
+    if (precificacao->usaProdutos())
+        precificacao->inicializa(calculaNormasColunas());
+    else
+        precificacao->inicializa(std::vector<double>(colunas, 0));
+}
+
+std::vector<double> Simplex::calculaNormasColunas()
 {
-    int contagemNumNegativos = 0;
-    double minimo = std::numeric_limits<double>::max();
-    int localizacao = 0;
+    std::vector<double> normas(colunas, 0);
+
+    for (int i = 0 ; i < linhas ; i++) // A matriz é armazenada por linhas, então acumulamos linha a linha
+    {
+        for (int j = 0 ; j < colunas ; j++)
+            normas[j] += A[i][j] * A[i][j];
+    }
+
+    return normas;
+}
+
+void Simplex::atualizaPrecificacao(int linhaPivo, int colunaNumPivo)
+{
+    DadosPivoteamento dados;
+    std::vector<double> produtos;
+
+    dados.entrada = colunaNumPivo;
+    dados.saida = base[linhaPivo].first;
+    dados.pivo = A[linhaPivo][colunaNumPivo];
+    dados.linhaPivo = A[linhaPivo];
+    dados.normaColuna = 0;
+    dados.produtos = nullptr;
+    dados.n = colunas;
 
     for (int i = 0 ; i < linhas ; i++)
+        dados.normaColuna += A[i][colunaNumPivo] * A[i][colunaNumPivo];
+
+    if (precificacao->usaProdutos()) // Produto da coluna que entra com todas as colunas, combinando as linhas do tableau
     {
-        if (A[i][colunaNumPivo] <= 0)
-            contagemNumNegativos++;
+        produtos.assign(colunas, 0);
+
+        for (int i = 0 ; i < linhas ; i++)
+        {
+            if (A[i][colunaNumPivo] != 0)
+                subtraiMultiplo(produtos.data(), A[i], -A[i][colunaNumPivo], colunas);
+        }
+
+        dados.produtos = produtos.data();
     }
 
-    if (contagemNumNegativos == linhas) // Critério de parada do Simplex. Se todos os coeficientes são 0 na função objetivo.
+    precificacao->atualiza(dados);
+}
+
+std::vector<double> Simplex::calculaNormasLinhas()
+{
+    std::vector<double> normas(linhas, 0);
+
+    for (int i = 0 ; i < linhas ; i++)
     {
-        eIlimitado = true;
-        return -1;
+        for (int j = 0 ; j < colunas ; j++)
+            normas[i] += A[i][j] * A[i][j];
     }
 
+    return normas;
+}
+
+void Simplex::atualizaPesosLinhas(int linhaPivo, int colunaNumPivo)
+{
+    DadosPivoteamentoLinhas dados;
+    std::vector<double> coluna(linhas);
+    std::vector<double> produtos(linhas, 0);
+
     for (int i = 0 ; i < linhas ; i++)
+        coluna[i] = A[i][colunaNumPivo];
+
+    for (int i = 0 ; i < linhas ; i++) // Apenas as linhas que o pivoteamento altera, como em pivoteiaTableau
     {
-        if (A[i][colunaNumPivo] > 0) // Iremos testar apenas linhas que possuem coeficientes positivos na coluna pivô.
-        {
-            if (B[i] / A[i][colunaNumPivo] <= minimo) // Devemos encontrar o mínimo.
-            {              
-                minimo =  B[i] / A[i][colunaNumPivo];
-                localizacao = i;
-            }
-        }
+        if (coluna[i] == 0)
+            continue;
+
+        for (int j = 0 ; j < colunas ; j++)
+            produtos[i] += A[i][j] * A[linhaPivo][j];
     }
 
+    dados.linhaPivo = linhaPivo;
+    dados.pivo = coluna[linhaPivo];
+    dados.colunaEntrada = coluna.data();
+    dados.produtos = produtos.data();
+    dados.m = linhas;
+
+    precificacao->atualizaPesosLinhas(dados);
+}
+
+int Simplex::achaLinhaPivo(int colunaNumPivo)
+{
+    colunaPivo.resize(linhas);
+
+    for (int i = 0 ; i < linhas ; i++) // A coluna é copiada para um vetor contíguo, pois a matriz é armazenada por linhas
+        colunaPivo[i] = A[i][colunaNumPivo] > TOLERANCIA_PIVO ? A[i][colunaNumPivo] : 0;
+
+    int localizacao = escolheLinhaRazao(colunaPivo); // Testa apenas linhas com coeficientes positivos na coluna pivô
+
+    if (localizacao == -1) // Critério de parada do Simplex. Se não há coeficiente positivo na coluna pivô, a solução é ilimitada.
+        eIlimitado = true;
+
     return localizacao;
 }
 
@@ -420,20 +615,24 @@ bool Simplex::realizaPrimeiraFase()
         imprimeInformacao("====================================================\n\n");
         imprimeInformacao("Iniciando a segunda fase...\n\n\n");
 
+        removeArtificiaisDaBase();
+
         C_artificial.clear();
 
         for (int i = 0 ; i < numVarArtificiais ; i++)
             C.pop_back(); // Remove as variáveis artificiais da função objetivo original
 
-        for (int i = 0 ; i < linhas ; i++)
-        {
-            for (int j = 0 ; j < numVarArtificiais ; j++)
-                A[i].pop_back(); // Remove as variáveis artificiais da função objetivo original
-        }
+        A.removeColunas(numVarArtificiais); // Remove as variáveis artificiais da matriz de coeficientes, mantendo o espaço como reserva
 
         colunas = C.size(); // Número de variáveis sem as artificiais
+
+        limiteInferior.resize(colunas);
+        limiteSuperior.resize(colunas);
+        naSuperior.resize(colunas);
+        precificacao->redimensiona(colunas);
         
         eDuasFases = false; // Encerramos a primeira fase
+        reiniciaProgresso(); // O objetivo da segunda fase é outro
 
         return true;
     }
@@ -447,10 +646,46 @@ bool Simplex::realizaPrimeiraFase()
     }
 }
 
+void Simplex::removeArtificiaisDaBase()
+{
+    int primeiraArtificial = colunas - numVarArtificiais;
+    std::vector<bool> eBasica(colunas, false);
+
+    for (const auto &variavel : base)
+        eBasica[variavel.first] = true;
+
+    for (int r = 0 ; r < linhas ; r++)
+    {
+        if (base[r].first < primeiraArtificial)
+            continue;
+
+        for (int j = 0 ; j < primeiraArtificial ; j++)
+        {
+            if (eBasica[j] || std::fabs(A[r][j]) <= TOLERANCIA_PIVO)
+                continue;
+
+            /* Pivoteamento degenerado: a artificial tem valor nulo, então a variável que entra mantém o seu valor e as demais não mudam */
+
+            double valorEntrada = valorNaoBasica(j);
+
+            eBasica[base[r].first] = false;
+            eBasica[j] = true;
+            naSuperior[j] = false;
+            B[r] = valorEntrada;
+            base[r] = {j, valorEntrada};
+
+            pivoteiaTableau(r, j);
+            break;
+        }
+    }
+}
+
 void Simplex::aplicaSimplex(std::vector<int> ondeAdicionar)
 {
     int iteracao = 1;
 
+    iniciaPrecificacao(); // A base inicial é formada pelas variáveis de folga e artificiais
+
     if (eDuasFases)
     {
         imprimeInformacao("O método de duas fases deve ser aplicado. Iniciando primeira fase... \n\n\n");
@@ -470,6 +705,9 @@ void Simplex::aplicaSimplex(std::vector<int> ondeAdicionar)
 
     imprimeInformacao("\n");
 
+    if (perturbaB)
+        aplicaPerturbacao();
+
     while (!fim)
     {
         bool resultado = calculaIteracaoSimplex(iteracao);
@@ -480,9 +718,533 @@ void Simplex::aplicaSimplex(std::vector<int> ondeAdicionar)
             fim = true;
     }
 
+    if (!perturbacao.empty())
+        removePerturbacao();
+
     realizaImpressaoFinal();     
 }
 
+void Simplex::aplicaPerturbacao()
+{
+    std::mt19937 gerador(linhas); // Semente fixa, para que a execução seja reprodutível
+    std::uniform_real_distribution<double> distribuicao(0.5, 1);
+
+    perturbacao.resize(linhas);
+    perturbacaoObjetivo = 0;
+
+    for (int i = 0 ; i < linhas ; i++)
+    {
+        perturbacao[i] = PERTURBACAO_RELATIVA * (1 + std::fabs(B[i])) * distribuicao(gerador);
+        B[i] += perturbacao[i];
+        base[i].second = B[i];
+    }
+
+    imprimeInformacao("Vetor B perturbado para evitar pivoteamentos degenerados.\n\n");
+}
+
+void Simplex::removePerturbacao()
+{
+    bool viavel = true;
+
+    for (int i = 0 ; i < linhas ; i++)
+    {
+        B[i] -= perturbacao[i];
+        base[i].second = B[i];
+
+        if (eLinhaRedundante(i))
+            continue;
+
+        if (B[i] < limiteInferior[base[i].first] - TOLERANCIA_VIABILIDADE || B[i] > limiteSuperior[base[i].first] + TOLERANCIA_VIABILIDADE)
+            viavel = false;
+    }
+
+    solucaoOtima -= perturbacaoObjetivo;
+    perturbacao.clear();
+    perturbacaoObjetivo = 0;
+
+    imprimeInformacao("Perturbação do vetor B removida.\n\n");
+
+    if (!viavel && !semSolucao && !eIlimitado) // A base continua dualmente viável, então o Simplex dual restaura a viabilidade primal
+        realizaDualSimplex();
+}
+
+bool Simplex::realizaIteracaoComLimites()
+{
+    std::vector<double> &custos = eDuasFases ? C_artificial : C;
+    std::vector<double> custosEfetivos(colunas); // Custos no sentido em que cada variável pode variar
+
+    for (int j = 0 ; j < colunas ; j++)
+    {
+        if (limiteInferior[j] == limiteSuperior[j]) // Variável fixa, não pode entrar na base
+            custosEfetivos[j] = std::numeric_limits<double>::infinity();
+        else
+            custosEfetivos[j] = naSuperior[j] ? -custos[j] : custos[j]; // No limite superior, a variável só pode diminuir
+    }
+
+    int colunaNumPivo = escolheColunaEntrada(custosEfetivos.data(), colunas);
+
+    if (colunaNumPivo == -1)
+        return false;
+
+    double sentido = naSuperior[colunaNumPivo] ? -1 : 1;
+    double passo = limiteSuperior[colunaNumPivo] - limiteInferior[colunaNumPivo]; // Troca de limite da própria variável
+    double limiteHarris = passo; // Menor passo com os limites relaxados pela tolerância, na primeira passagem de Harris
+    int linhaPivo = -1;
+    std::vector<double> passos(linhas, std::numeric_limits<double>::infinity()); // Passo máximo permitido por cada linha
+    std::vector<double> taxas(linhas);
+
+    for (int i = 0 ; i < linhas ; i++)
+    {
+        double taxa = sentido * A[i][colunaNumPivo]; // Quanto a variável básica diminui por unidade de passo
+        int variavelBasica = base[i].first;
+        double folga;
+
+        if (taxa > TOLERANCIA_PIVO)
+            folga = B[i] - limiteInferior[variavelBasica];
+        else if (taxa < -TOLERANCIA_PIVO && limiteSuperior[variavelBasica] != std::numeric_limits<double>::infinity())
+            folga = limiteSuperior[variavelBasica] - B[i];
+        else
+            continue;
+
+        taxas[i] = taxa;
+        passos[i] = std::max(folga, 0.0) / std::fabs(taxa);
+        limiteHarris = std::min(limiteHarris, (folga + TOLERANCIA_HARRIS) / std::fabs(taxa));
+    }
+
+    if (modoBland) // Menor passo, com empates decididos pela variável básica de menor índice
+    {
+        for (int i = 0 ; i < linhas ; i++)
+        {
+            if (passos[i] < passo - TOLERANCIA_EMPATE
+                || (passos[i] <= passo + TOLERANCIA_EMPATE && linhaPivo != -1 && base[i].first < base[linhaPivo].first))
+            {
+                passo = std::min(passo, passos[i]);
+                linhaPivo = i;
+            }
+        }
+    }
+
+    else if (usaHarris)
+    {
+        if (passo > limiteHarris) // A troca de limite não tem pivô, então é preferida sempre que cabe no passo relaxado
+        {
+            double maiorTaxa = 0;
+
+            for (int i = 0 ; i < linhas ; i++) // Segunda passagem: entre os passos dentro do limite relaxado, o maior pivô
+            {
+                if (passos[i] <= limiteHarris && std::fabs(taxas[i]) >= maiorTaxa)
+                {
+                    maiorTaxa = std::fabs(taxas[i]);
+                    linhaPivo = i;
+                }
+            }
+
+            passo = passos[linhaPivo];
+        }
+    }
+
+    else
+    {
+        for (int i = 0 ; i < linhas ; i++)
+        {
+            if (passos[i] <= passo) // Em caso de empate, a última linha é escolhida, como em indiceMenorRazao
+            {
+                passo = passos[i];
+                linhaPivo = i;
+            }
+        }
+    }
+
+    bool saiNaSuperior = linhaPivo != -1 && taxas[linhaPivo] < 0;
+
+    if (passo == std::numeric_limits<double>::infinity())
+    {
+        eIlimitado = true;
+        return false;
+    }
+
+    double variacao = sentido * passo;
+    double valorEntrada = valorNaoBasica(colunaNumPivo) + variacao;
+
+    for (int i = 0 ; i < linhas ; i++)
+    {
+        B[i] -= A[i][colunaNumPivo] * variacao;
+        base[i].second = B[i];
+    }
+
+    solucaoOtima -= C[colunaNumPivo] * variacao;
+
+    if (eDuasFases)
+        solucaoOtimaPrimeiraFase -= C_artificial[colunaNumPivo] * variacao;
+
+    if (linhaPivo == -1) // A variável apenas troca de limite, sem pivoteamento
+    {
+        naSuperior[colunaNumPivo] = !naSuperior[colunaNumPivo];
+        return true;
+    }
+
+    naSuperior[base[linhaPivo].first] = saiNaSuperior;
+    naSuperior[colunaNumPivo] = false;
+    B[linhaPivo] = valorEntrada;
+    base[linhaPivo] = {colunaNumPivo, valorEntrada};
+
+    pivoteiaTableau(linhaPivo, colunaNumPivo);
+
+    return true;
+}
+
+bool Simplex::realizaDualSimplex()
+{
+    const double tolerancia = 1e-9; // Violações de limite abaixo desse valor são desconsideradas
+    std::vector<bool> eBasica;
+
+    objetivoCortado = false;
+
+    if (precificacao->usaNormaLinhas() && precificacao->numPesosLinhas() != linhas) // Pesos exatos apenas no início, e atualizados a cada pivoteamento
+        precificacao->inicializaPesosLinhas(calculaNormasLinhas());
+
+    while (true)
+    {
+        int linhaPivo = -1;
+        double melhorCriterio = 0;
+
+        for (int i = 0 ; i < linhas ; i++) // Sai da base a variável mais distante dos seus limites
+        {
+            if (eLinhaRedundante(i))
+                continue;
+
+            int variavelBasica = base[i].first;
+            double violacao = std::max(limiteInferior[variavelBasica] - B[i], B[i] - limiteSuperior[variavelBasica]);
+
+            if (violacao <= tolerancia)
+                continue;
+
+            double criterio = violacao;
+
+            if (precificacao->usaNormaLinhas()) // Steepest edge dual: a violação é normalizada pelo peso da linha, a norma da linha do tableau
+                criterio = violacao * violacao / precificacao->pesoLinha(i);
+
+            if (criterio > melhorCriterio)
+            {
+                melhorCriterio = criterio;
+                linhaPivo = i;
+            }
+        }
+
+        if (linhaPivo == -1)
+            break;
+
+        int variavelSaida = base[linhaPivo].first;
+        bool abaixo = B[linhaPivo] < limiteInferior[variavelSaida]; // A variável que sai deve aumentar até o limite inferior
+        int colunaNumPivo = -1;
+        double menorRazao = std::numeric_limits<double>::infinity();
+
+        eBasica.assign(colunas, false);
+
+        for (int i = 0 ; i < linhas ; i++)
+        {
+            if (!eLinhaRedundante(i))
+                eBasica[base[i].first] = true;
+        }
+
+        for (int j = 0 ; j < colunas ; j++) // Teste da razão dual: mantém os custos reduzidos dualmente viáveis
+        {
+            if (eBasica[j] || limiteInferior[j] == limiteSuperior[j])
+                continue;
+
+            /* A variável que sai varia de -A[linhaPivo][j] por unidade de aumento de x_j, que só pode aumentar no limite inferior e diminuir no superior */
+
+            double elemento = naSuperior[j] ? -A[linhaPivo][j] : A[linhaPivo][j];
+
+            if (abaixo ? elemento < -tolerancia : elemento > tolerancia)
+            {
+                double razao = std::max(naSuperior[j] ? -C[j] : C[j], 0.0) / std::fabs(elemento);
+
+                if (razao < menorRazao)
+                {
+                    menorRazao = razao;
+                    colunaNumPivo = j;
+                }
+            }
+        }
+
+        if (colunaNumPivo == -1) // A linha não admite valor dentro dos limites para a variável básica
+        {
+            semSolucao = true;
+            return false;
+        }
+
+        double alvo = abaixo ? limiteInferior[variavelSaida] : limiteSuperior[variavelSaida];
+        double variacao = (B[linhaPivo] - alvo) / A[linhaPivo][colunaNumPivo];
+        double valorEntrada = valorNaoBasica(colunaNumPivo) + variacao;
+
+        for (int i = 0 ; i < linhas ; i++)
+        {
+            B[i] -= A[i][colunaNumPivo] * variacao;
+            base[i].second = B[i];
+        }
+
+        solucaoOtima -= C[colunaNumPivo] * variacao;
+
+        naSuperior[variavelSaida] = !abaixo;
+        naSuperior[colunaNumPivo] = false;
+        B[linhaPivo] = valorEntrada;
+        base[linhaPivo] = {colunaNumPivo, valorEntrada};
+
+        pivoteiaTableau(linhaPivo, colunaNumPivo);
+
+        if (solucaoOtima < limiteObjetivo) // O valor final não passará do atual, que já está abaixo do corte
+        {
+            objetivoCortado = true;
+            return true;
+        }
+    }
+
+    for (int i = 0 ; i < linhas ; i++) // Elimina os resíduos fora dos limites dentro da tolerância
+    {
+        if (eLinhaRedundante(i))
+            continue;
+
+        int variavelBasica = base[i].first;
+
+        B[i] = std::min(std::max(B[i], limiteInferior[variavelBasica]), limiteSuperior[variavelBasica]);
+        base[i].second = B[i];
+    }
+
+    return true;
+}
+
+double Simplex::valorNaoBasica(int j) const
+{
+    return naSuperior[j] ? limiteSuperior[j] : limiteInferior[j];
+}
+
+void Simplex::alteraLimites(int j, double inferior, double superior)
+{
+    double valorAnterior = valorNaoBasica(j);
+
+    limiteInferior[j] = inferior;
+    limiteSuperior[j] = superior;
+    temLimites = true;
+
+    if (naSuperior[j] && superior == std::numeric_limits<double>::infinity())
+        naSuperior[j] = false;
+
+    for (int i = 0 ; i < linhas ; i++)
+    {
+        if (base[i].first == j) // Variável básica: o valor não muda, apenas a viabilidade
+            return;
+    }
+
+    double variacao = valorNaoBasica(j) - valorAnterior;
+
+    if (variacao == 0)
+        return;
+
+    for (int i = 0 ; i < linhas ; i++) // As variáveis básicas compensam a mudança da não básica
+    {
+        B[i] -= A[i][j] * variacao;
+        base[i].second = B[i];
+    }
+
+    solucaoOtima -= C[j] * variacao;
+}
+
+void Simplex::adicionaRestricao(const std::vector<double> &coeficientes, double lado)
+{
+    std::vector<double> alfa(coeficientes);
+    std::vector<double> linha(colunas + 1, 0); // A linha da folga no tableau, com a coluna da própria folga ao final
+    std::vector<bool> eBasica(colunas, false);
+    double folga = -lado; // Valor atual da folga, coeficientes^T x - lado
+
+    alfa.resize(colunas, 0);
+
+    for (int i = 0 ; i < linhas ; i++) // Cada variável básica é substituída pela sua linha: x_b = B_i - soma A[i][j] (x_j - valor_j)
+    {
+        if (eLinhaRedundante(i))
+            continue;
+
+        int variavelBasica = base[i].first;
+
+        eBasica[variavelBasica] = true;
+
+        if (alfa[variavelBasica] == 0)
+            continue;
+
+        folga += alfa[variavelBasica] * B[i];
+
+        for (int j = 0 ; j < colunas ; j++)
+            linha[j] += alfa[variavelBasica] * A[i][j];
+    }
+
+    for (int j = 0 ; j < colunas ; j++)
+    {
+        if (eBasica[j]) // Elimina o resíduo de arredondamento nas colunas básicas, que devem ser nulas
+            linha[j] = 0;
+
+        else
+        {
+            linha[j] -= alfa[j];
+            folga += alfa[j] * valorNaoBasica(j);
+        }
+    }
+
+    linha[colunas] = 1;
+
+    for (int i = 0 ; i < linhas ; i++) // As artificiais das linhas redundantes continuam com índice além da última coluna
+    {
+        if (eLinhaRedundante(i))
+            base[i].first++;
+    }
+
+    A.adicionaColuna();
+    A.adicionaLinha(linha);
+
+    C.push_back(0);
+    limiteInferior.push_back(0);
+    limiteSuperior.push_back(std::numeric_limits<double>::infinity());
+    naSuperior.push_back(false);
+    B.push_back(folga);
+    base.push_back({colunas, folga});
+
+    linhas++;
+    colunas++;
+
+    precificacao->redimensiona(colunas);
+}
+
+void Simplex::removeRestricao(int i)
+{
+    int folga = base[i].first;
+
+    A.removeLinha(i);
+    A.removeColuna(folga);
+
+    B.erase(B.begin() + i);
+    base.erase(base.begin() + i);
+    C.erase(C.begin() + folga);
+    limiteInferior.erase(limiteInferior.begin() + folga);
+    limiteSuperior.erase(limiteSuperior.begin() + folga);
+    naSuperior.erase(naSuperior.begin() + folga);
+
+    linhas--;
+    colunas--;
+
+    for (auto &b : base) // As colunas após a da folga, e as artificiais das linhas redundantes, deslocam-se uma posição
+    {
+        if (b.first > folga)
+            b.first--;
+    }
+
+    iniciaPrecificacao(); // Os pesos das colunas seguintes estariam deslocados
+}
+
+void Simplex::substituiObjetivo(const std::vector<double> &coeficientes)
+{
+    std::vector<double> valores(colunas);
+
+    for (int j = 0 ; j < colunas ; j++)
+        valores[j] = valorNaoBasica(j);
+
+    for (int i = 0 ; i < linhas ; i++)
+    {
+        if (!eLinhaRedundante(i))
+            valores[base[i].first] = B[i];
+    }
+
+    C.assign(colunas, 0);
+    std::copy(coeficientes.begin(), coeficientes.begin() + std::min((int) coeficientes.size(), colunas), C.begin());
+
+    solucaoOtima = 0;
+
+    for (int j = 0 ; j < colunas ; j++)
+        solucaoOtima -= C[j] * valores[j];
+
+    for (int i = 0 ; i < linhas ; i++) // C_j - C_b A[i][j], que zera o custo reduzido da básica, já que A[i][b] = 1
+    {
+        if (eLinhaRedundante(i) || C[base[i].first] == 0)
+            continue;
+
+        int variavelBasica = base[i].first;
+
+        subtraiMultiplo(C.data(), A[i], C[variavelBasica], colunas);
+        C[variavelBasica] = 0;
+    }
+
+    perturbacaoObjetivo = 0;
+    reiniciaProgresso();
+    iniciaPrecificacao();
+}
+
+void Simplex::defineLimitesSuperiores(const std::vector<double> &limites)
+{
+    for (int j = 0 ; j < (int) limites.size() ; j++)
+    {
+        limiteSuperior[j] = limites[j];
+
+        if (limites[j] != std::numeric_limits<double>::infinity())
+            temLimites = true;
+    }
+}
+
+void Simplex::definePrecificacao(RegraPrecificacao regra)
+{
+    precificacao = Precificacao(regra);
+}
+
+void Simplex::defineTratamentoDegeneracao(bool usaHarris, int limiteSemProgresso, bool perturbaB)
+{
+    this->usaHarris = usaHarris;
+    this->limiteSemProgresso = limiteSemProgresso;
+    this->perturbaB = perturbaB;
+}
+
+void Simplex::defineEscalaColunas(const std::vector<double> &escala)
+{
+    escalaColunas = escala;
+}
+
+void Simplex::defineConstanteObjetivo(double constante)
+{
+    constanteObjetivo = eMaximizacao ? -constante : constante; // O objetivo interno é -C^T x, com C negado na minimização
+    solucaoOtima += constanteObjetivo;
+}
+
+bool Simplex::retornaSolucao(std::vector<double> &valores, std::vector<int> &basicas)
+{
+    if (semSolucao || eIlimitado)
+        return false;
+
+    valores.resize(colunas);
+    basicas.clear();
+
+    for (int j = 0 ; j < colunas ; j++)
+        valores[j] = valorDesescalonado(j, valorNaoBasica(j));
+
+    for (auto &b : base)
+    {
+        if (b.first < colunas)
+            valores[b.first] = valorDesescalonado(b.first, b.second);
+
+        basicas.push_back(b.first);
+    }
+
+    return true;
+}
+
+double Simplex::valorDesescalonado(int j, double valor) const
+{
+    if (j >= (int) escalaColunas.size()) // Sem escalonamento, ou variável artificial
+        return valor;
+
+    return valor * escalaColunas[j];
+}
+
+void Simplex::garanteTableauFinal()
+{
+
+}
+
 void Simplex::realizaImpressaoFinal()
 {
     if (!semSolucao && !eIlimitado)
@@ -500,16 +1262,35 @@ void Simplex::realizaImpressaoFinal()
 
         while (it != base.end())
         {
-            std::cout << "x" << it->first + 1 << " " << it->second << " " << std::endl;
+            std::cout << "x" << it->first + 1 << " " << valorDesescalonado(it->first, it->second) << " " << std::endl;
             it++;
         }
 
         std::cout << std::endl;
 
-        if (!eMaximizacao && solucaoOtima != 0)
-            solucaoOtima *= -1; // A implementação é baseada em maximização. Para obter a solução de uma minimização, basta multiplicar por -1.
+        if (temLimites)
+        {
+            std::cout << "Variáveis não básicas com valor não nulo: " << std::endl;
+            std::cout << "====================================================" << std::endl;
+
+            std::vector<bool> eBasica(colunas, false);
+
+            for (auto &b : base)
+                eBasica[b.first] = true;
+
+            for (int j = 0 ; j < colunas ; j++)
+            {
+                if (!eBasica[j] && valorNaoBasica(j) != 0)
+                    std::cout << "x" << j + 1 << " " << valorDesescalonado(j, valorNaoBasica(j)) << " " << std::endl;
+            }
+
+            std::cout << std::endl;
+        }
+
+        /* A implementação é baseada em maximização. Para obter a solução de uma minimização, basta multiplicar por -1.
+        O valor interno não é alterado, pois o Branch and Bound parte do tableau final e compara os nós por ele. */
 
-        std::cout << "Solução ótima: " << solucaoOtima << std::endl;
+        std::cout << "Solução ótima: " << (!eMaximizacao && solucaoOtima != 0 ? solucaoOtima * -1 : solucaoOtima) << std::endl;
         std::cout << "====================================================" << std::endl;
     }   
 }
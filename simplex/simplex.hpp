@@ -2,6 +2,14 @@
 #define SIMPLEX_H
 
 #include <vector>
+#include <string>
+
+#include "../util/matriz.hpp"
+#include "../util/precificacao.hpp"
+
+const double TOLERANCIA_PIVO = 1e-9; // Coeficientes da coluna pivô abaixo desse valor são resíduos de arredondamento e não podem ser pivôs
+const double TOLERANCIA_VIABILIDADE = 1e-9; // Valores básicos negativos acima de -TOLERANCIA_VIABILIDADE são resíduos de arredondamento
+const double PERTURBACAO_RELATIVA = 1e-7; // Escala da perturbação do vetor B, relativa ao valor de cada elemento
 
 /**
  * @brief Implementa o método Simplex e o método de duas fases.
@@ -14,12 +22,31 @@ class Simplex
         int linhas, colunas; // Linhas = número de restrições ; Colunas = número de variáveis
         int numVarArtificiais; // Número de variáveis artificiais no problema
         int numVars; // Número de variáveis na forma canônica
-        std::vector <std::vector<double> > A; // Matriz dos coeficientes das restrições
+        Matriz A; // Matriz dos coeficientes das restrições, armazenada de forma contígua
         std::vector<double> B; // Vetor de soluções das restrições
         std::vector<double> C; // Vetor de coeficientes da função objetivo.
         std::vector< std::pair<int, double> > base; // Vetor de pares para mapearmos as bases e os B_i's respectivos
         std::vector <double> C_artificial; // Vetor de coeficientes da função objetivo artificial da primeira fase
+        std::vector <double> colunaPivo; // Cópia contígua da coluna pivô, utilizada no teste da razão
+        std::vector <int> naoNulosLinhaPivo; // Colunas com elementos não nulos na linha pivô, utilizadas quando a linha é esparsa
+        std::vector <double> limiteInferior; // Limite inferior de cada variável
+        std::vector <double> limiteSuperior; // Limite superior de cada variável, infinito se não houver
+        std::vector <bool> naSuperior; // Indica se a variável não básica está no limite superior. Caso contrário, está no inferior
+        bool temLimites; // Indica se alguma variável tem limites diferentes de [0, infinito), o que exige o teste da razão com limites
+        Precificacao precificacao; // Estratégia de escolha da variável que entra na base
+        bool usaHarris; // Indica se o teste da razão de Harris é utilizado. Caso contrário, a menor razão exata
+        int limiteSemProgresso; // Número de iterações sem aumento do objetivo até a aplicação da regra de Bland
+        int iteracoesSemProgresso; // Iterações consecutivas sem aumento do objetivo
+        double ultimoObjetivo; // Objetivo da fase atual na iteração anterior
+        bool modoBland; // Indica se a regra de Bland está em uso, até que o objetivo volte a crescer
+        bool perturbaB; // Indica se o vetor B é perturbado no início da segunda fase
+        std::vector <double> perturbacao; // Perturbação atual do vetor B, transformada pelos pivoteamentos. Vazio se não há perturbação
+        double perturbacaoObjetivo; // Parcela do objetivo causada pela perturbação
+        double limiteObjetivo; // Corte do objetivo: o Simplex dual para quando o objetivo fica abaixo desse valor. -infinito desativa
+        bool objetivoCortado; // Indica se o último Simplex dual parou pelo corte do objetivo, antes de restaurar a viabilidade
         double solucaoOtima; // Solução ótima do problema
+        double constanteObjetivo; // Parcela constante do objetivo interno, das variáveis removidas pelo presolve
+        std::vector <double> escalaColunas; // Fator de escala de cada coluna: o valor da variável no problema original é o fator vezes o valor interno. Vazio se não há escalonamento
         double solucaoOtimaPrimeiraFase; // Solução ótima da primeira fase
         bool eIlimitado; // Caso que o problema é ilimitado
         bool eMaximizacao; // Utilizada para verificar se o problema é de maximização ou não.
@@ -39,20 +66,91 @@ class Simplex
         virtual bool calculaIteracaoSimplex(int iteracao);
 
         /**
-         * @brief Verifica se todos os coeficientes são positivos ou nulos.
+         * @brief Aplica o pivoteamento em cada linha que não seja a pivô.
          * 
-         * @return true - Se não há valores negativos na função objetivo.
-         * @return false - Se ainda há valor negativo na função objetivo.
+         * @param linhaPivo O índice da linha do número pivô
+         * @param colunaNumPivo O índice da coluna do número pivô
          */
-        bool verificarSolucaoOtima();
+        void realizaPivoteamento(int linhaPivo, int colunaNumPivo);
 
         /**
-         * @brief Aplica o pivoteamento em cada linha que não seja a pivô.
+         * @brief Realiza o pivoteamento apenas na matriz A e nos vetores C e C artificial, sem alterar os valores das variáveis.
          * 
          * @param linhaPivo O índice da linha do número pivô
          * @param colunaNumPivo O índice da coluna do número pivô
          */
-        void realizaPivoteamento(int linhaPivo, int colunaNumPivo);
+        void pivoteiaTableau(int linhaPivo, int colunaNumPivo);
+
+        /**
+         * @brief Realiza uma iteração do Simplex com limites nas variáveis. Uma variável não básica no limite inferior pode aumentar
+         * e uma no limite superior pode diminuir. O teste da razão considera os dois limites das variáveis básicas e o da própria variável
+         * que entra, que pode apenas trocar de limite sem entrar na base.
+         * 
+         * @return true - Se houve pivoteamento ou troca de limite
+         * @return false - Se a solução é ótima ou ilimitada
+         */
+        bool realizaIteracaoComLimites();
+
+        /**
+         * @brief Retorna o valor de uma variável não básica, que está em um dos seus limites
+         * 
+         * @param j O índice da variável
+         */
+        double valorNaoBasica(int j) const;
+
+        /**
+         * @brief Indica se a variável básica da linha é uma artificial que não pôde sair da base na primeira fase. Isso só ocorre em
+         * restrições redundantes, cuja linha do tableau é nula: a artificial vale sempre 0, não tem limites e a linha é ignorada nos testes de viabilidade.
+         * 
+         * @param i O índice da linha
+         */
+        bool eLinhaRedundante(int i) const { return base[i].first >= colunas; }
+
+        /**
+         * @brief Altera os limites de uma variável do problema resolvido. Se ela é não básica, os valores das variáveis básicas
+         * são ajustados ao seu novo valor; se é básica, o Simplex dual deve ser aplicado caso o valor atual fique fora dos limites.
+         * 
+         * @param j O índice da variável
+         * @param inferior O novo limite inferior
+         * @param superior O novo limite superior
+         */
+        void alteraLimites(int j, double inferior, double superior);
+
+        /**
+         * @brief Acrescenta ao problema resolvido a restrição coeficientes^T x >= lado, com uma nova variável de folga básica e limitada a [0, infinito).
+         * A linha do tableau é obtida eliminando as variáveis básicas da restrição, então a base continua dualmente viável. Se a solução atual
+         * viola a restrição, a folga fica negativa e a viabilidade deve ser restaurada pelo Simplex dual.
+         * 
+         * @param coeficientes O coeficiente de cada variável, na escala interna. Variáveis além do tamanho do vetor têm coeficiente nulo
+         * @param lado O lado direito da restrição
+         */
+        void adicionaRestricao(const std::vector<double> &coeficientes, double lado);
+
+        /**
+         * @brief Remove uma restrição cuja variável básica é uma folga que não aparece em nenhuma outra linha, como a de uma restrição
+         * acrescentada por adicionaRestricao. A linha e a coluna da folga são retiradas, e a base das demais linhas continua ótima.
+         * 
+         * @param i O índice da linha
+         */
+        void removeRestricao(int i);
+
+        /**
+         * @brief Substitui a função objetivo do problema resolvido, mantendo a base. Os custos reduzidos são recalculados eliminando
+         * as variáveis básicas, então a base continua primalmente viável e o Simplex primal pode reotimizá-la a partir dela.
+         * 
+         * @param coeficientes Os coeficientes C do novo objetivo interno, -C^T x, na escala interna. Variáveis além do tamanho do vetor têm coeficiente nulo
+         */
+        void substituiObjetivo(const std::vector<double> &coeficientes);
+
+        /**
+         * @brief Subtrai de um vetor um múltiplo da linha pivô. Se a linha pivô for esparsa, percorre apenas os seus elementos não nulos.
+         * 
+         * @param destino O vetor a ser atualizado (uma linha de A, C ou C_artificial)
+         * @param linhaPivo O índice da linha do número pivô
+         * @param multiplicador O múltiplo da linha pivô
+         * @param n O número de elementos do vetor
+         */
+        void subtraiLinhaPivo(double *destino, int linhaPivo, double multiplicador, int n);
 
         /**
          * @brief Imprime a matriz A e os vetores B e C.
@@ -60,6 +158,12 @@ class Simplex
          */
         virtual void printMatrizes();
 
+        /**
+         * @brief Imprime apenas a matriz A. Utilizada por printMatrizes.
+         * 
+         */
+        virtual void printMatrizA();
+
         /**
          * @brief Imprime a matriz A e os vetores B e C da última iteração.
          * 
@@ -67,12 +171,92 @@ class Simplex
         virtual void printMatrizesFinais();
 
         /**
-         * @brief Procura pelo coeficiente mais negativo da função objetivo
+         * @brief Escolhe a variável que entra na base pela estratégia de precificação, verificando a otimalidade na mesma passagem
          * 
-         * @return int - O índice da coluna que contém o número mais negativo.
+         * @return int - O índice da coluna escolhida, ou -1 se não há coeficiente negativo na função objetivo, ou seja, a solução é ótima.
          */
         int achaColunaPivo();
 
+        /**
+         * @brief Escolhe a variável que entra na base pela estratégia de precificação ou, se não há progresso há muitas iterações, pela regra de Bland
+         * 
+         * @param custos Os custos reduzidos, com custo infinito nas colunas que não podem entrar na base
+         * @param n O número de colunas
+         * @return int O índice da coluna escolhida, ou -1 se a solução é ótima
+         */
+        int escolheColunaEntrada(const double *custos, int n);
+
+        /**
+         * @brief Conta as iterações consecutivas sem aumento do objetivo, ativando a regra de Bland quando atingem o limite
+         * 
+         */
+        void registraProgresso();
+
+        /**
+         * @brief Reinicia a contagem de iterações sem progresso, no início de uma nova fase ou de um novo nó
+         * 
+         */
+        void reiniciaProgresso();
+
+        /**
+         * @brief Teste da razão sobre uma coluna já transformada pela base. Utiliza o teste de Harris em duas passagens ou a menor razão exata
+         * e, com a regra de Bland ativa, decide os empates pela variável básica de menor índice.
+         * 
+         * @param coluna A coluna da variável que entra, com os coeficientes abaixo de TOLERANCIA_PIVO zerados
+         * @return int O índice da linha do número pivô, ou -1 se não há coeficiente positivo
+         */
+        int escolheLinhaRazao(const std::vector<double> &coluna);
+
+        /**
+         * @brief Perturba o vetor B com pequenos valores aleatórios positivos, eliminando os empates que causam pivoteamentos degenerados
+         * 
+         */
+        virtual void aplicaPerturbacao();
+
+        /**
+         * @brief Remove a perturbação do vetor B e do objetivo. Se algum valor básico ficar inviável, a viabilidade é restaurada pelo Simplex dual,
+         * que mantém a otimalidade da base.
+         * 
+         */
+        virtual void removePerturbacao();
+
+        /**
+         * @brief Inicializa os pesos da estratégia de precificação para a base atual
+         * 
+         */
+        void iniciaPrecificacao();
+
+        /**
+         * @brief Calcula a soma dos quadrados de cada coluna do tableau, utilizada pela precificação steepest edge
+         * 
+         * @return std::vector<double> A soma de cada coluna
+         */
+        virtual std::vector<double> calculaNormasColunas();
+
+        /**
+         * @brief Fornece à estratégia de precificação os dados da troca de base, antes do pivoteamento do tableau
+         * 
+         * @param linhaPivo O índice da linha do número pivô
+         * @param colunaNumPivo O índice da coluna do número pivô
+         */
+        void atualizaPrecificacao(int linhaPivo, int colunaNumPivo);
+
+        /**
+         * @brief Calcula a soma dos quadrados de cada linha do tableau, o peso inicial das linhas no Simplex dual steepest edge
+         * 
+         * @return std::vector<double> A soma de cada linha
+         */
+        std::vector<double> calculaNormasLinhas();
+
+        /**
+         * @brief Fornece à estratégia de precificação os produtos da linha pivô com as linhas alteradas pelo pivoteamento,
+         * para a atualização dos pesos das linhas do Simplex dual, antes do pivoteamento do tableau
+         * 
+         * @param linhaPivo O índice da linha do número pivô
+         * @param colunaNumPivo O índice da coluna do número pivô
+         */
+        void atualizaPesosLinhas(int linhaPivo, int colunaNumPivo);
+
         /**
          * @brief Procura pela linha i tal que B_i / A[i][colunaNumPivo] é o menor dos valores.
          * 
@@ -100,6 +284,36 @@ class Simplex
 
         virtual bool realizaPrimeiraFase();
 
+        /**
+         * @brief Retira da base as variáveis artificiais que permaneceram nela com valor nulo ao fim da primeira fase, quando possível.
+         * Caso contrário, a segunda fase poderia aumentar o valor delas, já sem as colunas artificiais, e chegar a uma solução inviável.
+         *
+         */
+
+        virtual void removeArtificiaisDaBase();
+
+        /**
+         * @brief Aplica o Simplex dual a partir de um tableau com custos reduzidos dualmente viáveis e alguma variável básica fora dos seus limites,
+         * como ocorre após alterarmos os limites de uma variável básica de um problema já resolvido.
+         * Como o objetivo só diminui a cada pivoteamento dual, ele limita o valor final, e o Simplex dual para assim que o objetivo fica
+         * abaixo de limiteObjetivo, com objetivoCortado indicado e a viabilidade ainda não restaurada.
+         * 
+         * @return true - Se a viabilidade foi restaurada ou o objetivo foi cortado
+         * @return false - Se o problema não possui solução
+         */
+
+        bool realizaDualSimplex();
+
+        /**
+         * @brief Converte o valor interno de uma variável para a escala do problema fornecido
+         * 
+         * @param j O índice da variável
+         * @param valor O valor interno
+         * @return double O valor no problema fornecido
+         */
+
+        double valorDesescalonado(int j, double valor) const;
+
         /**
          * @brief Realiza a impressão dos resultados na última iteração
          * 
@@ -123,6 +337,14 @@ class Simplex
 
         virtual void imprimeInformacao(double informacao);
 
+        /**
+         * @brief Construtor para as classes derivadas que guardam a matriz de coeficientes em outro formato. A matriz A permanece vazia.
+         * 
+         * @param linhas Número de restrições
+         * @param colunas Número de variáveis
+         */
+        Simplex (int linhas, int colunas, std::vector<double> b, std::vector<double> c, bool tipoProblema, bool eDuasFases, int numVarArtificiais, int numVars);
+
     public:
         /**
          * @brief Construtor da classe
@@ -133,7 +355,74 @@ class Simplex
          * @param tipoProblema true se é de maximização, false se é de minimização.
          * @param eDuasFases true se o problema tem duas fases, false caso contrário.
          */
-        Simplex (std::vector <std::vector<double>> coeficientes, std::vector<double> b, std::vector<double> c, bool tipoProblema, bool eDuasFases, int numVarArtificiais, int numVars);        
+        Simplex (Matriz coeficientes, std::vector<double> b, std::vector<double> c, bool tipoProblema, bool eDuasFases, int numVarArtificiais, int numVars);        
+
+        virtual ~Simplex() = default;
+
+        /* O destrutor declarado suprime a movimentação implícita, e os nós do Branch and Bound são movidos entre filas e threads */
+
+        Simplex(const Simplex &) = default;
+
+        Simplex(Simplex &&) = default;
+
+        Simplex &operator=(const Simplex &) = default;
+
+        Simplex &operator=(Simplex &&) = default;
+
+        /**
+         * @brief Garante que a matriz A e os vetores B e C contenham o tableau final, necessário para o Branch and Bound.
+         * No método tradicional, eles já o contêm ao fim da resolução.
+         * 
+         */
+        virtual void garanteTableauFinal();
+
+        /**
+         * @brief Define os limites superiores das variáveis da forma canônica antes da resolução
+         * 
+         * @param limites O limite superior de cada variável, infinito se não houver
+         */
+        void defineLimitesSuperiores(const std::vector<double> &limites);
+
+        /**
+         * @brief Define a estratégia de precificação utilizada na escolha da variável que entra na base
+         * 
+         * @param regra A regra de precificação
+         */
+        void definePrecificacao(RegraPrecificacao regra);
+
+        /**
+         * @brief Define o tratamento de degeneração
+         * 
+         * @param usaHarris true para o teste da razão de Harris, false para a menor razão exata
+         * @param limiteSemProgresso Número de iterações sem aumento do objetivo até a aplicação da regra de Bland
+         * @param perturbaB true para perturbar o vetor B durante a segunda fase
+         */
+        void defineTratamentoDegeneracao(bool usaHarris, int limiteSemProgresso, bool perturbaB);
+
+        /**
+         * @brief Define a parcela constante da função objetivo antes da resolução, como a das variáveis fixadas pelo presolve
+         * 
+         * @param constante A constante, com os coeficientes da função objetivo como fornecidos
+         */
+        void defineConstanteObjetivo(double constante);
+
+        /**
+         * @brief Define os fatores de escala das colunas de um problema escalonado antes da resolução. Os valores das variáveis
+         * retornados e impressos ao final, e os limites da ramificação do Branch and Bound, passam a estar na escala do problema fornecido.
+         * 
+         * @param escala O fator de cada coluna, incluindo as folgas
+         */
+        void defineEscalaColunas(const std::vector<double> &escala);
+
+        /**
+         * @brief Retorna os valores das variáveis e as variáveis básicas após a resolução
+         * 
+         * @param valores Recebe o valor de cada variável, básica ou não, na escala do problema fornecido
+         * @param basicas Recebe o índice da variável básica de cada restrição
+         * @return true - Se o problema possui solução ótima
+         * @return false - Se o problema não possui solução ou é ilimitado
+         */
+        bool retornaSolucao(std::vector<double> &valores, std::vector<int> &basicas);
 
         /**
          * @brief Função que inicia o método Simplex.
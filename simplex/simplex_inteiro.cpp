@@ -3,93 +3,384 @@
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <utility>
+#include <limits>
+#include <memory>
+#include <atomic>
 
 /**
  * @file simplex_inteiro.cpp
- * @brief Implementa um problema de programação linear inteira geral utilizando busca em largura sem heurística.
+ * @brief Implementa um problema de programação linear inteira geral utilizando Branch and Bound com regras de seleção de nós.
  * 
  * Partimos do nó raiz se esse não possui uma solução inteira com tolerância de 7 casas decimais.
  * Para cada nó, dividimos o problema em dois, com uma restrição x_i < piso(k) e x_i > piso(k) + 1,
- * onde x_i é a primeira coordenada fracionária encontrada e k é seu valor fracionário.
- * A resolução dos problemas é feita na criação e análise de resultados é feita realizando busca em largura.
- * Resolvemos um nível da árvore do Branch and Bound antes de prosseguirmos para o próximo.
- * Isso é implementado utilizando o conceito padrão de busca em largura, que é através de uma fila.
+ * onde x_i é a coordenada fracionária escolhida pela EstrategiaRamificacao e k é seu valor fracionário.
+ * A restrição é aplicada como um novo limite da variável, e o nó é resolvido pelo Simplex dual a partir de uma base ótima.
+ * Assim, o tableau de um nó tem sempre o mesmo tamanho que o do problema original.
+ * Os nós abertos guardam apenas os limites alterados em relação à raiz, e o tableau é reconstruído a partir do tableau final da raiz,
+ * compartilhado apenas para leitura, quando o nó é retirado. Apenas o filho que a thread resolve em seguida, no mergulho, copia o tableau do pai.
+ * Os nós abertos ficam em uma FilaNos, que escolhe o próximo nó pela busca em largura, pelo melhor limite, pela melhor estimativa
+ * ou pela busca em profundidade. Os nós são resolvidos apenas ao serem retirados, então a prioridade de um nó é dada pelo pai.
+ * No mergulho, a thread que ramifica um nó resolve imediatamente o filho do lado do arredondamento da variável e empilha o irmão,
+ * que é retomado quando o mergulho termina. Assim, os nós abertos são apenas os irmãos dos caminhos em mergulho.
+ * No mergulho, cada thread empilha os irmãos em um DequeTrabalho próprio, sem travas, e as threads ociosas roubam os nós mais rasos
+ * das demais. As outras regras dependem da ordem de todos os nós abertos e usam a FilaNos compartilhada.
+ * A solução incumbente é uma Incumbente, lida sem travas nos testes de poda.
+ * A incumbente é alimentada também pelas Heuristicas primais, aplicadas na raiz antes da ramificação e periodicamente nos nós.
+ * Com uma incumbente, os custos reduzidos fixam variáveis: os da raiz valem em toda a árvore e são aplicados antes da resolução de cada nó,
+ * e os de cada nó resolvido valem na sua sub-árvore e passam aos filhos com os demais limites alterados.
+ * Antes do Simplex dual, a Propagacao aperta os limites de cada nó pelas restrições e descarta, sem resolução, os nós que ela mostra inviáveis.
+ * O fim é detectado por um contador atômico de nós pendentes. Antes de cada nó, as threads verificam os critérios de parada do Acompanhamento,
+ * os limites de nós, de tempo, de gap e de soluções, e a primeira que encontra um critério atendido encerra a busca para todas. Cada nó encerrado vira um registro compacto, gravado em arquivo por um
+ * RegistroArvore, e a impressão final percorre o arquivo em blocos, na ordem de encerramento, então a memória acompanha os nós abertos e não a árvore inteira.
+ * As comparações usam o objetivo interno do Simplex, que é sempre maximizado, tanto na maximização quanto na minimização.
  */
 
 #include "simplex_inteiro.hpp"
+#include "fila_nos.hpp"
+#include "deque_trabalho.hpp"
+#include "registro_arvore.hpp"
+#include "incumbente.hpp"
+#include "ramificacao.hpp"
+#include "cortes.hpp"
+#include "heuristicas.hpp"
+#include "acompanhamento.hpp"
+#include "propagacao.hpp"
 #include "../util/preparador.hpp"
 #include "simplex.hpp"
 
-int SimplexInteiro::numTotalProblemas = 1; // Inicialização do membro static da classe SimplexInteiro
+static const double FRACAO_MINIMA_GOMORY = 0.01; // Linhas com parte fracionária a menos disso de um inteiro não geram cortes de Gomory
+static const double COEFICIENTE_MAXIMO_GOMORY = 1e6; // Linhas do tableau com coeficientes maiores que esse valor não geram cortes
+static const double COEFICIENTE_RELATIVO_MINIMO = 1e-9; // Coeficientes de um corte menores que essa fração do maior são removidos
+static const double DINAMISMO_MAXIMO_GOMORY = 1e6; // Razão máxima entre o maior e o menor coeficiente de um corte
+static const double CUSTO_REDUZIDO_MINIMO = 1e-9; // Custos reduzidos menores que esse valor não fixam a variável
+static const double TOLERANCIA_FIXACAO = 1e-6; // Folga do arredondamento dos limites da fixação por custos reduzidos, contra o erro numérico
+static const double TOLERANCIA_CORTE_OBJETIVO = 1e-9; // Distância relativa abaixo da incumbente em que o Simplex dual de um nó é interrompido
+
+std::atomic<int> SimplexInteiro::numTotalProblemas(1); // Inicialização do membro static da classe SimplexInteiro
 static int numVariaveisCanonica; // Número de variáveis na forma canônica, visível somente para esse arquivo
-static std::queue<std::pair<SimplexInteiro, std::vector<int>>> fila; // Fila de problemas ramificados para serem analisados
+static FilaNos fila; // Nós abertos, ramificados e ainda não resolvidos, nas regras que não usam o roubo de trabalho
+static double limiteRaiz; // Valor da relaxação linear da raiz, no objetivo interno
+static double inviabilidadeRaiz; // Soma das inviabilidades inteiras da solução da raiz
+static std::unique_ptr<PseudoCustos> pseudoCustos; // Pseudo-custos das variáveis, alimentados por todas as threads
+static std::unique_ptr<EstrategiaRamificacao> ramificacao; // Escolha da variável ramificada, compartilhada pelas threads
+static std::unique_ptr<EstruturaBinaria> estruturaBinaria; // Mochilas e conflitos das variáveis binárias, nulo se não há estrutura binária
+static int profundidadeCortes; // Profundidade máxima dos nós em que os cortes de cobertura e de clique são separados
+static std::unique_ptr<Heuristicas> heuristicas; // Heurísticas primais, nulo se desativadas
+static int frequenciaHeuristicas; // Intervalo, em nós, entre dois mergulhos heurísticos
+static std::unique_ptr<Propagacao> propagacao; // Propagação dos limites pelas restrições, aplicada em cada nó antes da resolução
+static const SimplexInteiro *raiz; // Nó raiz já resolvido, do qual os nós abertos são reconstruídos. Não é alterado durante o Branch and Bound
+
+static int numThreads; // Número de threads que resolvem os nós
+
+static std::vector< std::unique_ptr<DequeTrabalho> > deques; // Nós abertos de cada thread no mergulho
+static std::vector< std::vector<int> > ordemRoubo; // Para cada thread, as demais threads na ordem em que ela tenta roubar: primeiro as do mesmo nó NUMA
+static thread_local int idTrabalhador = 0; // Índice da thread atual em deques e no registro da árvore. A thread principal usa o 0 antes de criar as demais
+
+static std::mutex mutexFila; // Mutex para acesso à fila
+static std::condition_variable temElemento; // Condicional para avisar que há elemento na fila ou que o Branch and Bound acabou
 
-/* Ponteiros de funções para a comparação entre a solução incumbente e a solução encontrada no nó */
+static std::atomic<bool> fim(false); // Indicador que todos os nós foram podados ou que a busca foi interrompida por um critério de parada
+static std::atomic<int> nosPendentes(0); // Nós criados e ainda não encerrados: na fila, em um deque ou em resolução
+static Acompanhamento acompanhamento; // Nós resolvidos, melhor limite dos nós abertos e critérios de parada
 
-static bool (*comparaSolucoesInclusive)(double a, double b); // Caso para a poda por solução inteira e alteração dessa
-static bool (*comparaSolucoesExclusive)(double a, double b); // Caso para a poda por solução menor que a atual
+std::vector<std::thread> threads; // Vetor que contém as threads que resolvem os nós
 
-static std::mutex mutexFila; // Mutex para acesso à fila
-static std::mutex mutexSolucao; // Mutex para acesso às variáveis de solução incumbente
-static std::mutex mutexNumProblema; // Mutex para acessar o membro estático da classe SimplexInteiro
-static std::mutex mutexProblemas; // Mutex para alterar o número de problemas em execução
-static std::mutex mutexFim; // Mutex para acessar a variável de fim
-static std::mutex mutexVetorProblemas; // Mutex para acessar o vetor de problemas encerrados
-static std::condition_variable temElemento; // Condicional para avisar que há elemento na fila
+static RegistroArvore registroArvore; // Registro dos nós encerrados, para a impressão final
+
+SimplexInteiro::SimplexInteiro(Simplex s) : Simplex(std::move(s))
+{
+    this->idProblema = this->numTotalProblemas; // Identificador deste problema
+    this->idPai = 0;
+    this->ramo = {-1, false, 0};
+    this->profundidade = 0;
+    this->limitePai = this->estimativa = solucaoOtima;
+    this->colunasOriginais = colunas;
+}
 
-static bool fim = false; // Indicador que todos os nós foram podados
+AlteracaoLimite SimplexInteiro::calculaRamificacao(int posicaoNaoInteiro, double limite, bool eMenor) const
+{
+    limite = limite / valorDesescalonado(posicaoNaoInteiro, 1); // O limite é dado na escala do problema fornecido
+
+    double inferior = eMenor ? limiteInferior[posicaoNaoInteiro] : limite;
+    double superior = eMenor ? limite : limiteSuperior[posicaoNaoInteiro];
+
+    return {posicaoNaoInteiro, inferior, superior};
+}
+
+void SimplexInteiro::adicionaRamificacao(int posicaoNaoInteiro, double limite, bool eMenor)
+{
+    aplicaAlteracoes({calculaRamificacao(posicaoNaoInteiro, limite, eMenor)});
+}
 
-int problemasExecutando = 0; // Contador para indicar o número de problemas em aberto
+/**
+ * @brief Substitui ou acrescenta a alteração de uma variável na lista, que mantém no máximo uma alteração por variável
+ * 
+ */
 
-std::vector<std::thread> threads; // Vetor que contém as 5 threads que concorrem pela fila
+static void registraAlteracao(std::vector<AlteracaoLimite> &alteracoes, const AlteracaoLimite &alteracao)
+{
+    for (auto &existente : alteracoes)
+    {
+        if (existente.variavel == alteracao.variavel) // Os limites de uma ramificação mais profunda já contêm os anteriores
+        {
+            existente = alteracao;
+            return;
+        }
+    }
 
-std::vector<SimplexInteiro> problemasEncerrados; // Vetor que contém todos os problemas encerrados para informação futura
+    alteracoes.push_back(alteracao);
+}
 
-SimplexInteiro::SimplexInteiro(Simplex s, std::vector<std::vector<double>> aOriginal, std::vector<double> bOriginal, std::vector<double> cOriginal) : Simplex(s)
+void SimplexInteiro::aplicaAlteracoes(const std::vector<AlteracaoLimite> &novas)
 {
-    /* Inicialização dos elementos que guardarão o problema original e inicialização de novos elementos, já que eles foram copiados do objeto s. */
+    for (const auto &alteracao : novas)
+    {
+        registraAlteracao(alteracoes, alteracao);
+
+        if (alteracao.inferior > alteracao.superior) // A ramificação esvazia o intervalo da variável
+            semSolucao = true;
+        else if (!semSolucao)
+            alteraLimites(alteracao.variavel, alteracao.inferior, alteracao.superior);
+    }
+}
+
+std::vector<Corte> SimplexInteiro::separaGomory(int numVars, const std::vector<Corte> &cortes) const
+{
+    std::vector<Corte> separados;
+    std::vector<bool> eBasica(colunas, false);
+
+    for (int i = 0 ; i < linhas ; i++)
+    {
+        if (!eLinhaRedundante(i))
+            eBasica[base[i].first] = true;
+    }
+
+    for (int i = 0 ; i < linhas ; i++)
+    {
+        int variavelBasica = base[i].first;
+
+        if (eLinhaRedundante(i) || variavelBasica >= numVars)
+            continue;
+
+        /* A linha é x_b + soma a_j y_j = valor, com y_j >= 0 a distância de x_j ao seu limite, na escala do problema fornecido */
+
+        double escalaBasica = valorDesescalonado(variavelBasica, 1);
+        double valor = B[i] * escalaBasica;
+        double f0 = valor - std::floor(valor);
+
+        if (f0 < FRACAO_MINIMA_GOMORY || f0 > 1 - FRACAO_MINIMA_GOMORY) // Linhas quase inteiras geram cortes numericamente instáveis
+            continue;
+
+        std::vector<double> coeficientes(colunas, 0);
+        double lado = 1; // O corte é soma g_j y_j >= 1
+        bool instavel = false;
+
+        for (int j = 0 ; j < colunas ; j++)
+        {
+            if (eBasica[j] || A[i][j] == 0 || limiteInferior[j] == limiteSuperior[j]) // Uma variável fixada tem distância sempre nula
+                continue;
+
+            double escalaColuna = valorDesescalonado(j, 1);
+            double a = (naSuperior[j] ? -A[i][j] : A[i][j]) * escalaBasica / escalaColuna;
+
+            if (std::fabs(a) > COEFICIENTE_MAXIMO_GOMORY)
+            {
+                instavel = true;
+                break;
+            }
+
+            double g;
+
+            if (j < numVars && eInteiro(valorNaoBasica(j) * escalaColuna)) // Distância inteira ao limite: coeficiente pela parte fracionária
+            {
+                double fj = a - std::floor(a);
+
+                g = fj <= f0 ? fj / f0 : (1 - fj) / (1 - f0);
+            }
+
+            else
+                g = a >= 0 ? a / f0 : -a / (1 - f0);
+
+            /* Volta à variável interna: y_j = x_j - inferior no limite inferior, e superior - x_j no superior */
+
+            coeficientes[j] = (naSuperior[j] ? -g : g) * escalaColuna;
+            lado += coeficientes[j] * valorNaoBasica(j);
+        }
+
+        if (instavel)
+            continue;
+
+        for (int k = 0 ; k < (int) cortes.size() ; k++) // A folga de um corte é coeficientes^T x - lado
+        {
+            double multiplicador = coeficientes[colunasOriginais + k];
+
+            if (multiplicador == 0)
+                continue;
 
-   this->aOriginal = realizaCopiaProfunda(aOriginal);
-   this->bOriginal = realizaCopiaProfunda(bOriginal);
-   this->cOriginal = realizaCopiaProfunda(cOriginal);
+            for (int j = 0 ; j < colunasOriginais ; j++)
+                coeficientes[j] += multiplicador * cortes[k].coeficientes[j];
 
-   this->A = realizaCopiaProfunda(aOriginal);
-   this->B = realizaCopiaProfunda(bOriginal);
-   this->C = realizaCopiaProfunda(cOriginal);
+            lado += multiplicador * cortes[k].lado;
+        }
+
+        coeficientes.resize(colunasOriginais);
+
+        double maior = 0;
+
+        for (double c : coeficientes)
+            maior = std::max(maior, std::fabs(c));
+
+        if (maior == 0)
+            continue;
+
+        double menor = maior;
+
+        for (int j = 0 ; j < colunasOriginais ; j++) // Remove os coeficientes desprezíveis, relaxando o lado direito pelo limite da variável
+        {
+            double c = coeficientes[j];
+
+            if (c == 0)
+                continue;
+
+            double limite = c > 0 ? limiteSuperior[j] : limiteInferior[j];
+
+            if (std::fabs(c) < COEFICIENTE_RELATIVO_MINIMO * maior && std::isfinite(limite))
+            {
+                lado -= c * limite;
+                coeficientes[j] = 0;
+            }
+
+            else
+                menor = std::min(menor, std::fabs(c));
+        }
+
+        if (maior / menor > DINAMISMO_MAXIMO_GOMORY)
+            continue;
 
-   this->idProblema = this->numTotalProblemas; // Identificador deste problema
+        double norma = 0;
+
+        for (double c : coeficientes)
+            norma += c * c;
+
+        separados.push_back({coeficientes, lado, std::sqrt(norma), 0});
+    }
+
+    return separados;
 }
 
-SimplexInteiro::SimplexInteiro(std::vector <std::vector<double>> coeficientes, std::vector<double> b, std::vector<double> c, bool tipoProblema, bool eDuasFases, int numVarArtificiais, int numVars, ElementosOriginais e)
-    : Simplex(coeficientes, b, c, tipoProblema, eDuasFases, numVarArtificiais, numVars)
+void SimplexInteiro::adicionaCorte(const Corte &corte)
 {
-    /* Copia o problema original */
-    this->aOriginal = e.A;
-    this->bOriginal = e.B;
-    this->cOriginal = e.C;
+    adicionaRestricao(corte.coeficientes, corte.lado);
 }
 
-std::vector<std::vector<double>> SimplexInteiro::getMatrizAOriginal()
+double SimplexInteiro::getFolgaCorte(int k) const
 {
-    return realizaCopiaProfunda(aOriginal);
+    for (int i = 0 ; i < linhas ; i++)
+    {
+        if (base[i].first == colunasOriginais + k)
+            return B[i];
+    }
+
+    return 0;
 }
 
-std::vector<double> SimplexInteiro::getVetorBOriginal()
+bool SimplexInteiro::removeCorte(int k)
 {
-    return realizaCopiaProfunda(bOriginal);
+    for (int i = 0 ; i < linhas ; i++)
+    {
+        if (base[i].first == colunasOriginais + k)
+        {
+            removeRestricao(i);
+            return true;
+        }
+    }
+
+    return false;
 }
 
-std::vector<double> SimplexInteiro::getVetorCOriginal()
+std::vector<double> SimplexInteiro::getValoresColunas() const
 {
-    return realizaCopiaProfunda(cOriginal);
+    std::vector<double> valores(colunasOriginais);
+
+    for (int j = 0 ; j < colunasOriginais ; j++)
+        valores[j] = valorNaoBasica(j);
+
+    for (int i = 0 ; i < linhas ; i++)
+    {
+        if (base[i].first < colunasOriginais)
+            valores[base[i].first] = B[i];
+    }
+
+    return valores;
+}
+
+void SimplexInteiro::defineObjetivo(const std::vector<double> &coeficientes)
+{
+    substituiObjetivo(coeficientes);
+}
+
+std::vector<AlteracaoLimite> SimplexInteiro::calculaFixacaoCustos(int numVars, double valorIncumbente) const
+{
+    std::vector<AlteracaoLimite> fixacoes;
+    double folga = solucaoOtima - valorIncumbente; // A piora máxima do objetivo para que uma solução ainda possa superar a incumbente
+
+    if (semSolucao || eIlimitado || !(folga >= 0) || valorIncumbente == -std::numeric_limits<double>::infinity())
+        return fixacoes;
+
+    std::vector<bool> eBasica(colunas, false);
+
+    for (int i = 0 ; i < linhas ; i++)
+    {
+        if (base[i].first < colunas)
+            eBasica[base[i].first] = true;
+    }
+
+    for (int j = 0 ; j < numVars ; j++)
+    {
+        if (eBasica[j] || std::fabs(C[j]) <= CUSTO_REDUZIDO_MINIMO)
+            continue;
+
+        double escala = valorDesescalonado(j, 1);
+        double distancia = folga * escala / std::fabs(C[j]); // Maior distância ao limite atual, na escala do problema fornecido
+
+        if (!naSuperior[j] && C[j] > 0) // No limite inferior, aumentar a variável piora o objetivo
+        {
+            double superior = std::floor(limiteInferior[j] * escala + distancia + TOLERANCIA_FIXACAO);
+
+            if (superior < limiteSuperior[j] * escala - TOLERANCIA_FIXACAO)
+                fixacoes.push_back({j, limiteInferior[j], superior / escala});
+        }
+
+        else if (naSuperior[j] && C[j] < 0) // No limite superior, diminuí-la piora o objetivo
+        {
+            double inferior = std::ceil(limiteSuperior[j] * escala - distancia - TOLERANCIA_FIXACAO);
+
+            if (inferior > limiteInferior[j] * escala + TOLERANCIA_FIXACAO)
+                fixacoes.push_back({j, inferior / escala, limiteSuperior[j]});
+        }
+    }
+
+    return fixacoes;
 }
 
-std::vector<std::pair<int, double>> SimplexInteiro::getBase()
+std::vector<double> SimplexInteiro::getSolucao(int numVars)
 {
-    return realizaCopiaProfunda(base);
+    std::vector<double> solucao(numVars);
+
+    for (int j = 0 ; j < numVars ; j++) // As variáveis não básicas estão em um dos seus limites
+        solucao[j] = valorDesescalonado(j, valorNaoBasica(j));
+
+    for (std::vector<double>::size_type i = 0 ; i < base.size() ; i++)
+    {
+        if (base[i].first < numVars) // Se o índice for menor que o número de variáveis na forma canônica, ele faz parte da forma canônica
+            solucao[base[i].first] = valorDesescalonado(base[i].first, base[i].second); // Coloca no vetor de soluções o valor mapeado, na escala do problema fornecido
+    }
+
+    return solucao;
 }
 
-double SimplexInteiro::getSolucaoOtima()
+double SimplexInteiro::getSolucaoOtima() const
 {
     return solucaoOtima;
 }
@@ -104,12 +395,12 @@ bool SimplexInteiro::getEIlimitado()
     return eIlimitado;
 }
 
-bool SimplexInteiro::getTipoProblema()
+bool SimplexInteiro::getTipoProblema() const
 {
     return tipoProblema;
 }
 
-int SimplexInteiro::getNumeroProblema(bool deTodos)
+int SimplexInteiro::getNumeroProblema(bool deTodos) const
 {
     if (deTodos) // Deseja-se o número de problemas criados até a chamada da função
         return numTotalProblemas;
@@ -138,14 +429,26 @@ void SimplexInteiro::setDivisoesProblema(int divisoes[2])
     divisoesProblema[1] = divisoes[1];
 }
 
+void SimplexInteiro::setDadosSelecao(int profundidade, double limitePai, double estimativa)
+{
+    this->profundidade = profundidade;
+    this->limitePai = limitePai;
+    this->estimativa = estimativa;
+}
+
 void SimplexInteiro::setNumeroProblema(int id)
 {
     idProblema = id;
 }
 
-void SimplexInteiro::aumentaQuantidadeProblemas()
+void SimplexInteiro::setPai(int id)
 {
-    numTotalProblemas += 2;
+    idPai = id;
+}
+
+int SimplexInteiro::aumentaQuantidadeProblemas()
+{
+    return numTotalProblemas.fetch_add(2);
 }
 
 void SimplexInteiro::imprimeInformacao(std::string informacao)
@@ -173,17 +476,22 @@ void SimplexInteiro::realizaImpressaoFinal()
     Simplex::realizaImpressaoFinal();
 }
 
+void SimplexInteiro::defineCorteObjetivo(double valorIncumbente)
+{
+    if (valorIncumbente == -std::numeric_limits<double>::infinity())
+        limiteObjetivo = valorIncumbente;
+    else
+        limiteObjetivo = valorIncumbente - TOLERANCIA_CORTE_OBJETIVO * std::max(1.0, std::fabs(valorIncumbente));
+}
+
 void SimplexInteiro::aplicaSimplex(std::vector<int> ondeAdicionar)
 {
     int iteracao = 1;
 
-    if (eDuasFases)
-    {
-        bool temSegundaFase = iniciaPrimeiraFase(ondeAdicionar);
+    reiniciaProgresso(); // A contagem do nó pai não vale para o novo problema
 
-        if (!temSegundaFase)
-            return;
-    }
+    if (semSolucao || !realizaDualSimplex() || objetivoCortado) // A restrição da ramificação torna o nó inviável, ou o nó não supera a incumbente
+        return;
 
     bool fim = false;
 
@@ -206,156 +514,319 @@ double (*retornaFuncaoComparacao(double solucaoOtima))(double valor)
         return std::ceil;
 }
 
-void controlaProblemasInteiros(double &solucaoOtimaGlobal, std::vector<double> &solucaoGlobal)
+/**
+ * @brief Encerra um nó retirado da fila ou de um deque. O encerramento do último nó pendente indica o fim do Branch and Bound.
+ * Os filhos de um nó ramificado são contados antes do encerramento do pai, então a contagem só chega a zero quando a árvore acabou.
+ * 
+ */
+
+static void encerraNo(const SimplexInteiro &problema)
 {
-    while (true) // Continua até haver problemas na fila
-    {             
-        std::unique_lock<std::mutex> mutexUnico(mutexFila); // Lock para verificar a fila
+    acompanhamento.encerraNo(problema.getNumeroProblema(false), problema.getLimitePai()); // O limite do nó deixa de contar no melhor limite
 
-        if (!fila.empty()) // Enquanto houver problema para ser analisado, prossegue na árvore
-        {
-            SimplexInteiro problemaMaisAntigo = fila.front().first; // Pega o problema mais antigo na fila
-            std::vector<int> ondeAdicionar = fila.front().second;
-            fila.pop(); // Remove da fila
+    if (nosPendentes.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        std::lock_guard<std::mutex> trava(mutexFila); // Uma thread que acabou de ver a fila vazia ainda não perde o aviso
 
-            mutexUnico.unlock(); // Acessou a fila, libera
+        fim = true;
+        temElemento.notify_all();
+    }
+}
 
-            problemaMaisAntigo.aplicaSimplex(ondeAdicionar); // Aplica o Simplex paralelamente
+/**
+ * @brief Interrompe o Branch and Bound por um critério de parada. Os nós ainda abertos não são resolvidos.
+ * 
+ */
 
-            mutexProblemas.lock();
-            problemasExecutando--; // Simplex aplicado nesse objeto, menos um problema executando
-            mutexProblemas.unlock();        
-            
-            verificaSolucaoInteira(problemaMaisAntigo, solucaoOtimaGlobal, solucaoGlobal); // Verifica se irá podar a sub-árvore ou criar novos problemas
-            continue;            
-        }
+static void interrompeBusca()
+{
+    std::lock_guard<std::mutex> trava(mutexFila); // As threads que aguardam a fila são acordadas
+
+    fim = true;
+    temElemento.notify_all();
+}
 
-        mutexFim.lock();
+/**
+ * @brief Registra um problema encerrado no bloco da thread atual. O tableau não é guardado, apenas o registro compacto do nó.
+ * 
+ * @param problema O problema, com o tipo de poda definido
+ * @param variavel A variável ramificada, ou -1 se o nó foi podado
+ * @param limite O piso do valor da variável ramificada, na escala do problema fornecido
+ */
 
-        if (!fim) // Se não chegou no fim do Branch and Bound, irá aguardar até a fila possuir elementos, caso haja prevalência de threads pelo consumo
-        {
-            mutexFim.unlock();
-            temElemento.wait(mutexUnico, []{ return fila.size() != 0 || fim; });
-        }
-        else // Caso contrário, encerrou. Saímos do while incondicional
-        {
-            mutexFim.unlock();
-            break;
-        }        
+static void registraEncerrado(SimplexInteiro &problema, int variavel = -1, double limite = 0)
+{
+    RegistroNo registro;
+
+    registro.idProblema = problema.getNumeroProblema(false);
+    registro.idPai = problema.getPai();
+    registro.variavel = variavel;
+    registro.divisoes[0] = problema.getDivisoesProblema()[0];
+    registro.divisoes[1] = problema.getDivisoesProblema()[1];
+    registro.tipoPoda = problema.getTipoPoda();
+    registro.resolvido = !problema.getSemSolucao() && !problema.getEIlimitado() && problema.getTipoPoda() != 4 && problema.getTipoPoda() != 5; // O nó descartado ou cortado não foi resolvido até o fim
+    registro.limite = limite;
+    registro.valor = problema.getSolucaoOtima();
+
+    registroArvore.registra(idTrabalhador, registro);
+}
+
+/**
+ * @brief Verifica se um valor da relaxação linear ainda pode superar a solução incumbente
+ * 
+ * @param valor O valor da relaxação, no objetivo interno
+ * @param solucaoOtimaGlobal A solução incumbente, no objetivo interno
+ * @return true Se o valor pode superar a incumbente
+ * @return false Se a sub-árvore pode ser podada
+ */
+
+static bool superaIncumbente(double valor, double solucaoOtimaGlobal)
+{
+    if (eInteiro(solucaoOtimaGlobal)) // Se a solução atual é inteira, iremos arredondar a que encontramos para verificação da capacidade de poda.
+    {
+        /* Um valor a menos de 10^-7 de um inteiro é esse inteiro com erro de arredondamento, e não pode ser arredondado para o inteiro vizinho */
+
+        double solucaoArredondada = eInteiro(valor) ? std::round(valor) : retornaFuncaoComparacao(valor)(valor);
+
+        return !(solucaoArredondada < solucaoOtimaGlobal);
     }
 
-    temElemento.notify_one(); // Efetua efeito dominó, para acordar as threads aguardando pela fila com elementos ou pelo fim
-    
+    return !(valor < solucaoOtimaGlobal); // Caso contrário, é uma comparação comum
 }
 
-bool eInteiro(double num)
+/**
+ * @brief Descarta, sem resolvê-lo, um nó cujo pai tem relaxação linear que não supera a solução incumbente encontrada desde a sua criação
+ * 
+ * @param problema O nó retirado da fila
+ * @param incumbente A solução incumbente
+ * @return true Se o nó foi descartado
+ * @return false Se o nó deve ser resolvido
+ */
+
+static bool descartaPeloLimite(SimplexInteiro &problema, const Incumbente &incumbente)
 {
-    return std::ceil(num * 10e7) / 10e7 == std::ceil(num); // Assume como número inteiro se esse tem 7 casas decimais nulas
+    if (superaIncumbente(problema.getLimitePai(), incumbente.getValor()))
+        return false;
+
+    problema.setTipoPoda(4); // Poda pelo limite do pai, sem resolução
+    registraEncerrado(problema);
+
+    return true;
 }
 
-int retornaPosicaoNaoInteiro(std::vector<double> solucao)
+/**
+ * @brief Insere um nó aberto: no deque da thread atual, no mergulho, ou na fila compartilhada, nas demais regras
+ * 
+ */
+
+static void publicaNo(NoAberto no)
 {
-    for (std::vector<double>::size_type i = 0 ; i < solucao.size(); i++)
+    if (fila.getRegra() == RegraSelecaoNo::MERGULHO)
     {
-        if (!eInteiro(solucao[i])) // Se essa coordenada não é inteira, a solução não é inteira. Retornará o índice dela
-            return i;
+        deques[idTrabalhador]->insere(new NoAberto(std::move(no)));
+        return;
     }
-    return -1;
+
+    std::lock_guard<std::mutex> trava(mutexFila);
+
+    fila.insere(std::move(no));
+    temElemento.notify_one(); // Notifica que há problema na fila
 }
 
 /**
- * @brief Reduz a quantidade de problemas executando. Se necessário, altera o estado da variável fim para indicar que todos os nós foram podados.
+ * @brief Reconstrói o tableau de um nó aberto aplicando os limites alterados sobre uma cópia do tableau final da raiz.
+ * A base da raiz é ótima, então continua dualmente viável com quaisquer limites, e o nó é resolvido pelo Simplex dual.
  * 
  */
 
-static void reduzProblemasExecutando()
+static std::unique_ptr<SimplexInteiro> reconstroiNo(const NoAberto &no)
 {
-    mutexProblemas.lock();
-    if (problemasExecutando == 0)
+    std::unique_ptr<SimplexInteiro> problema(new SimplexInteiro(*raiz));
+
+    problema->setNumeroProblema(no.idProblema);
+    problema->setPai(no.idPai);
+    problema->setRamo(no.ramo);
+    problema->setDadosSelecao(no.profundidade, no.limitePai, no.estimativa);
+    problema->aplicaAlteracoes(no.alteracoes);
+
+    return problema;
+}
+
+/**
+ * @brief Aplica a um nó os limites de uma fixação por custos reduzidos, apenas onde apertam os limites atuais do nó,
+ * que podem já ser mais estreitos que os do problema em que a fixação foi calculada
+ * 
+ * @return int O número de variáveis com limites apertados
+ */
+
+static int aplicaFixacao(SimplexInteiro &problema, const std::vector<AlteracaoLimite> &fixacoes)
+{
+    std::vector<AlteracaoLimite> novas;
+
+    for (const auto &fixacao : fixacoes)
     {
-        mutexFim.lock();
-        fim = true;
-        mutexFim.unlock();
+        double inferior = std::max(fixacao.inferior, problema.getLimiteInferior(fixacao.variavel));
+        double superior = std::min(fixacao.superior, problema.getLimiteSuperior(fixacao.variavel));
+
+        if (inferior > problema.getLimiteInferior(fixacao.variavel) || superior < problema.getLimiteSuperior(fixacao.variavel))
+            novas.push_back({fixacao.variavel, inferior, superior});
     }
-    mutexProblemas.unlock();
+
+    problema.aplicaAlteracoes(novas); // Um intervalo vazio torna o nó inviável sem resolução
+
+    return novas.size();
 }
 
 /**
- * @brief Recebe uma solução inteira e verifica se ela é melhor que a incumbente
+ * @brief Retira o próximo nó a ser resolvido pela thread atual. No mergulho, retira do próprio deque ou rouba de outra thread.
+ * Nas demais regras, aguarda até que a fila tenha um nó.
  * 
- * @param problema O problema que originou a solução
- * @param solucaoOtimaGlobal Solução incumbente
- * @param solucaoGlobal Coordenadas da solução incumbente
- * @param solucaoOtimaTeste Solução do problema a ser testada
- * @param solucao Coordenadas da solução do problema a ser testada
+ * @return std::unique_ptr<SimplexInteiro> O nó, ou nulo se o Branch and Bound acabou
  */
 
-static void realizaTratamentoSolucaoInteira(SimplexInteiro problema, double &solucaoOtimaGlobal, std::vector<double> &solucaoGlobal, double solucaoOtimaTeste, std::vector<double> solucao)
+static std::unique_ptr<SimplexInteiro> retiraProximoNo()
 {
-    mutexSolucao.lock(); // Por tratar de uma variável compartilhada, devemos travar
+    if (fila.getRegra() == RegraSelecaoNo::MERGULHO)
+    {
+        while (!fim.load(std::memory_order_acquire))
+        {
+            NoAberto *no = deques[idTrabalhador]->retira();
+
+            for (int i = 0 ; !no && i < (int) ordemRoubo[idTrabalhador].size() ; i++) // Os nós do mesmo nó NUMA estão na memória mais próxima
+                no = deques[ordemRoubo[idTrabalhador][i]]->rouba();
 
-    /* Se maximização, será a comparação solucaoOtimaGlobal <= solucaoOtimaTeste. Caso contrário, solucaoOtimaGlobal >= solucaoOtimaTeste */
+            if (no)
+                return reconstroiNo(*std::unique_ptr<NoAberto>(no));
 
-    if (comparaSolucoesInclusive(solucaoOtimaGlobal, solucaoOtimaTeste))
+            std::this_thread::yield(); // Os nós pendentes estão em resolução em outras threads, que podem empilhar irmãos
+        }
+
+        return nullptr;
+    }
+
+    std::unique_lock<std::mutex> trava(mutexFila);
+
+    temElemento.wait(trava, []{ return !fila.vazia() || fim; });
+
+    if (fim || fila.vazia()) // Acabou, ou a busca foi interrompida com nós ainda na fila
+        return nullptr;
+
+    NoAberto no = fila.retira(); // Pega o próximo problema conforme a regra de seleção
+
+    trava.unlock(); // A reconstrução do tableau não precisa da fila
+
+    return reconstroiNo(no);
+}
+
+void controlaProblemasInteiros(int trabalhador, Incumbente &incumbente)
+{
+    idTrabalhador = trabalhador;
+
+    while (std::unique_ptr<SimplexInteiro> problemaEscolhido = retiraProximoNo()) // Continua até o fim do Branch and Bound
     {
-        /* Atualiza a solução incumbente */
-        solucaoOtimaGlobal = solucaoOtimaTeste;
-        solucaoGlobal = solucao;
-        mutexSolucao.unlock();
+        while (problemaEscolhido) // No mergulho, continua no filho escolhido até a poda
+        {
+            if (acompanhamento.deveParar(incumbente, nosPendentes.load(std::memory_order_relaxed))) // O nó fica aberto, e o limite dele, no melhor limite
+            {
+                interrompeBusca();
+                return;
+            }
 
-        reduzProblemasExecutando(); 
+            if (descartaPeloLimite(*problemaEscolhido, incumbente)) // Uma solução inteira encontrada depois da criação do nó já o supera
+            {
+                encerraNo(*problemaEscolhido);
+                break;
+            }
 
-        problema.setTipoPoda(2); // Poda por ser solução inteira e melhor que a incumbente
+            /* Os custos reduzidos da raiz valem em toda a árvore, e a incumbente pode ter melhorado desde a criação do nó */
 
-        mutexVetorProblemas.lock();
-        problemasEncerrados.push_back(problema);
-        mutexVetorProblemas.unlock();
+            aplicaFixacao(*problemaEscolhido, raiz->calculaFixacaoCustos(numVariaveisCanonica, incumbente.getValor()));
 
-        return;
-    }
+            if (!problemaEscolhido->getSemSolucao()) // Os novos limites da ramificação e da fixação apertam outras variáveis, ou tornam o nó inviável
+                propagacao->propaga(*problemaEscolhido);
+
+            /* O Simplex dual para assim que o nó não pode mais superar a incumbente. O corte é retirado em seguida, pois as heurísticas,
+               a ramificação forte e os filhos resolvem cópias do nó até o fim */
 
-    mutexSolucao.unlock();
-    reduzProblemasExecutando();
+            problemaEscolhido->defineCorteObjetivo(incumbente.getValor());
+            problemaEscolhido->aplicaSimplex({}); // Aplica o Simplex paralelamente
+            problemaEscolhido->defineCorteObjetivo(-std::numeric_limits<double>::infinity());
 
-    problema.setTipoPoda(3); // Poda por ser solução inteira e pior que a incumbente
+            /* Verifica se irá podar a sub-árvore ou criar novos problemas. No mergulho, um dos filhos é resolvido em seguida por esta thread */
 
-    mutexVetorProblemas.lock();
-    problemasEncerrados.push_back(problema);
-    mutexVetorProblemas.unlock();
+            std::unique_ptr<SimplexInteiro> filho = verificaSolucaoInteira(*problemaEscolhido, incumbente);
+
+            encerraNo(*problemaEscolhido); // Os filhos, se houver, já foram contados
+
+            problemaEscolhido = std::move(filho);
+        }
+    }
 }
 
-bool deveRealizarPoda(SimplexInteiro problema, double &solucaoOtimaGlobal, std::vector<double> &solucaoGlobal, std::vector<double> solucao,
-                                        double solucaoOtimaTeste, int posicaoFracionario)
+bool eInteiro(double num)
 {
-    double (*funcComp)(double) = retornaFuncaoComparacao(solucaoOtimaTeste); // Função que será usada para arredondar para cima ou para baixo a solução encontrada
-    bool comparacaoSolucao; // Indicador se a solução encontrada é menor que a solução incumbente
+    return std::fabs(num - std::round(num)) < 1e-7; // Assume como número inteiro se esse está a menos de 10^-7 de um inteiro, acima ou abaixo
+}
 
-    mutexSolucao.lock();
+int retornaPosicaoNaoInteiro(std::vector<double> solucao)
+{
+    for (std::vector<double>::size_type i = 0 ; i < solucao.size(); i++)
+    {
+        if (!eInteiro(solucao[i])) // Se essa coordenada não é inteira, a solução não é inteira. Retornará o índice dela
+            return i;
+    }
+    return -1;
+}
 
-    if (eInteiro(solucaoOtimaGlobal)) // Se a solução atual é inteira, iremos arredondar a que encontramos para verificação da capacidade de poda.
-        comparacaoSolucao = comparaSolucoesExclusive(funcComp(solucaoOtimaTeste), solucaoOtimaGlobal);
+/**
+ * @brief Recebe uma solução inteira e verifica se ela é melhor que a incumbente
+ * 
+ * @param problema O problema que originou a solução
+ * @param incumbente Solução incumbente
+ * @param solucaoOtimaTeste Solução do problema a ser testada
+ * @param solucao Coordenadas da solução do problema a ser testada
+ */
 
-    else // Caso contrário, é uma comparação comum
-        comparacaoSolucao = comparaSolucoesExclusive(solucaoOtimaTeste, solucaoOtimaGlobal);
-    
-    mutexSolucao.unlock();
+static void realizaTratamentoSolucaoInteira(SimplexInteiro &problema, Incumbente &incumbente, double solucaoOtimaTeste, std::vector<double> solucao)
+{
+    for (double &valor : solucao) // Remove o resíduo numérico dos pivoteamentos, já que as coordenadas são inteiras dentro da tolerância
+        valor = std::round(valor);
 
-    if (comparacaoSolucao || problema.getSemSolucao() || problema.getEIlimitado()) // Poda por inviabilidade ou solução pior que a atual
+    if (incumbente.atualiza(solucaoOtimaTeste, solucao)) // A nova incumbente fica visível para os testes de poda de todas as threads
     {
-        problema.setTipoPoda(1); // Poda por ser uma solução inviável ou pior que a incumbente
+        problema.setTipoPoda(2); // Poda por ser solução inteira e melhor que a incumbente
+        registraEncerrado(problema);
+
+        return;
+    }
 
-        mutexVetorProblemas.lock();
-        problemasEncerrados.push_back(problema);
-        mutexVetorProblemas.unlock();
+    problema.setTipoPoda(3); // Poda por ser solução inteira que não supera a incumbente, pior ou de mesmo valor
+    registraEncerrado(problema);
+}
 
-        reduzProblemasExecutando();
+bool deveRealizarPoda(SimplexInteiro &problema, Incumbente &incumbente, std::vector<double> solucao, double solucaoOtimaTeste, int posicaoFracionario)
+{
+    if (problema.getObjetivoCortado()) // O Simplex dual parou com o objetivo abaixo da incumbente, antes de uma solução viável
+    {
+        problema.setTipoPoda(5);
+        registraEncerrado(problema);
+
+        return true;
+    }
+
+    bool comparacaoSolucao = !superaIncumbente(solucaoOtimaTeste, incumbente.getValor()); // Indicador se a solução encontrada é menor que a solução incumbente
+
+    if (comparacaoSolucao || problema.getSemSolucao() || problema.getEIlimitado()) // Poda por inviabilidade ou solução pior que a atual
+    {
+        problema.setTipoPoda(1); // Poda por ser uma solução inviável ou pior que a incumbente
+        registraEncerrado(problema);
 
         return true;
     }
 
     else if (posicaoFracionario == -1) // Poda de solução inteira encontrada
     {
-        realizaTratamentoSolucaoInteira(problema, solucaoOtimaGlobal, solucaoGlobal, solucaoOtimaTeste, solucao);
+        realizaTratamentoSolucaoInteira(problema, incumbente, solucaoOtimaTeste, solucao);
         
         return true;
     }    
@@ -363,199 +834,458 @@ bool deveRealizarPoda(SimplexInteiro problema, double &solucaoOtimaGlobal, std::
     return false;
 }
 
-void verificaSolucaoInteira(SimplexInteiro problema, double &solucaoOtimaGlobal, std::vector<double> &solucaoGlobal)
+/**
+ * @brief Aplica as heurísticas primais em um nó não podado: os arredondamentos em todos os nós e, a cada frequenciaHeuristicas nós,
+ * um mergulho, alternando entre o fracionário e o guiado pela incumbente
+ * 
+ * @return true Se a incumbente melhorou
+ */
+
+static bool aplicaHeuristicasNo(const SimplexInteiro &problema, const std::vector<double> &solucao, Incumbente &incumbente)
 {
-    std::vector<std::vector<double>> A = problema.getMatrizAOriginal(); // Retorna a matriz A do problema desse nó antes da resolução
-    std::vector<double> B = problema.getVetorBOriginal(); // Retorna o vetor B do problema desse nó antes da resolução
-    std::vector<double> C = problema.getVetorCOriginal(); // Retorna o vetor C do problema desse nó antes da resolução
-    double solucaoOtimaTeste = problema.getSolucaoOtima(); // Retorna a solução ótima encontrada
-    std::vector<std::pair<int, double>> base = problema.getBase(); // Retorna as variáveis básicas desse problema após a resolução  
-    bool tipoProblema = problema.getTipoProblema(); // Retorna o tipo de problema
-    std::vector<double> solucao(numVariaveisCanonica, 0); // Vetor solução contendo zeros
+    if (heuristicas->arredonda(problema, solucao, false, incumbente) || heuristicas->arredonda(problema, solucao, true, incumbente))
+        return true;
 
-    for (std::vector<double>::size_type i = 0 ; i < base.size() ; i++)
-    {
-        if (base[i].first < numVariaveisCanonica) // Se o índice for menor que o número de variáveis na forma canônica, ele faz parte da forma canônica
-            solucao[base[i].first] = base[i].second; // Coloca no vetor de soluções o valor mapeado
-    }
+    int id = problema.getNumeroProblema(false);
 
-    int posicaoFracionario = retornaPosicaoNaoInteiro(solucao); // Contém a posição da primeira coordenada fracionária encontrada
+    if (id % frequenciaHeuristicas != 0)
+        return false;
 
-    if (deveRealizarPoda(problema, solucaoOtimaGlobal, solucaoGlobal, solucao, solucaoOtimaTeste, posicaoFracionario)) 
-        return; // Algum dos três critérios de poda foi atendido
+    bool guiado = (id / frequenciaHeuristicas) % 2 == 1 && incumbente.getValor() != -std::numeric_limits<double>::infinity();
 
-    problema.setTipoPoda(0); // 0 = não encerrou
+    return heuristicas->mergulha(problema, guiado, incumbente);
+}
 
-    mutexNumProblema.lock();
+/**
+ * @brief Aplica as heurísticas primais na raiz, antes da ramificação, e informa a melhor solução encontrada
+ * 
+ */
 
-    int divisoes[2] = {problema.getNumeroProblema(true), problema.getNumeroProblema(true) + 1}; // Ramificações desse problema
-    problema.setDivisoesProblema(divisoes); // Guarda a informação das ramificações desse nó
-    problema.aumentaQuantidadeProblemas(); // Mais dois novos problemas surgirão
+static void aplicaHeuristicasRaiz(const SimplexInteiro &raiz, const std::vector<double> &solucao, Incumbente &incumbente)
+{
+    std::string encontrada; // A heurística que encontrou a incumbente, a última que a melhorou
 
-    mutexNumProblema.unlock();
+    if (heuristicas->arredonda(raiz, solucao, false, incumbente))
+        encontrada = "pelo arredondamento simples";
 
-    mutexVetorProblemas.lock();
-    problemasEncerrados.push_back(problema); // Coloca na marcação de encerramento
-    mutexVetorProblemas.unlock();  
+    if (heuristicas->arredonda(raiz, solucao, true, incumbente))
+        encontrada = "pelo arredondamento ZI";
 
-    criaNovosProblemas(A, B, C, posicaoFracionario, tipoProblema, solucao, solucaoOtimaGlobal, solucaoGlobal, divisoes);    
-}
+    if (heuristicas->mergulha(raiz, false, incumbente))
+        encontrada = "pelo mergulho fracionário";
 
-SimplexInteiro retornaProblema(std::vector<std::vector<double>> A, std::vector<double> B, std::vector<double> C, std::vector<double> solucao,
-                                int posicaoNaoInteiro, bool tipoProblema, bool eMenor, std::vector<int> &ondeAdicionar)
-{        
-    std::vector<double> novaRestricao; // Nova restrição da ramificação
+    if (encontrada.empty() && heuristicas->bombaViabilidade(raiz, incumbente)) // A bomba busca apenas a viabilidade
+        encontrada = "pela bomba de viabilidade";
 
-    for (std::vector<double>::size_type j = 0 ; j < A[0].size() ; j++) // Coloca os valores na coluna da nova restrição
+    if (!encontrada.empty() && heuristicas->mergulha(raiz, true, incumbente))
+        encontrada = "pelo mergulho guiado";
+
+    if (encontrada.empty())
     {
-        if ((int) j == posicaoNaoInteiro) // Se a coluna é a da coordenada fracionária, colocamos 1
-            novaRestricao.push_back(1);            
-        else // 0 caso contrário
-            novaRestricao.push_back(0);
+        std::cout << "Heurísticas na raiz: nenhuma solução inteira encontrada.\n";
+        return;
     }
 
-    if (eMenor) // Se a restrição é <=, colocamos 1 como variável de folga e o valor no vetor de soluções será o piso do valor da coordenada
+    double valor = incumbente.getValor();
+
+    std::cout << "Heurísticas na raiz: solução inteira de valor " << (!raiz.getTipoProblema() && valor != 0 ? valor * -1 : valor)
+        << ", encontrada " << encontrada << ".\n";
+}
+
+std::unique_ptr<SimplexInteiro> verificaSolucaoInteira(SimplexInteiro &problema, Incumbente &incumbente)
+{
+    double solucaoOtimaTeste = problema.getSolucaoOtima(); // Retorna a solução ótima encontrada
+    std::vector<double> solucao = problema.getSolucao(numVariaveisCanonica); // Valores das variáveis da forma canônica após a resolução
+    const RamoNo &ramo = problema.getRamo();
+
+    if (ramo.variavel >= 0 && !problema.getSemSolucao() && !problema.getEIlimitado() && !problema.getObjetivoCortado()) // A piora em relação ao pai é uma observação do pseudo-custo
+        pseudoCustos->registra(ramo.variavel, ramo.acima, problema.getLimitePai() - solucaoOtimaTeste, ramo.distancia);
+
+    int posicaoFracionario = retornaPosicaoNaoInteiro(solucao); // Contém a posição da primeira coordenada fracionária encontrada
+
+    if (deveRealizarPoda(problema, incumbente, solucao, solucaoOtimaTeste, posicaoFracionario)) 
+        return nullptr; // Algum dos três critérios de poda foi atendido
+
+    if (estruturaBinaria && problema.getProfundidade() <= profundidadeCortes && aplicaCortesNo(problema, *estruturaBinaria) > 0) // A relaxação do nó ficou mais forte
     {
-        novaRestricao.push_back(1);
-        B.push_back(std::floor(solucao[posicaoNaoInteiro]));
+        solucaoOtimaTeste = problema.getSolucaoOtima();
+        solucao = problema.getSolucao(numVariaveisCanonica);
+        posicaoFracionario = retornaPosicaoNaoInteiro(solucao);
+
+        if (deveRealizarPoda(problema, incumbente, solucao, solucaoOtimaTeste, posicaoFracionario))
+            return nullptr;
     }
 
-    else // Se a restrição é >=, colocamos -1 como variável de folga e o valor no vetor de soluções será o piso do valor da coordenada acrescido de 1
+    if (heuristicas && aplicaHeuristicasNo(problema, solucao, incumbente)) // A nova incumbente pode igualar o limite do próprio nó
     {
-        novaRestricao.push_back(-1);
-        B.push_back(std::floor(solucao[posicaoNaoInteiro]) + 1);
-    }    
+        if (deveRealizarPoda(problema, incumbente, solucao, solucaoOtimaTeste, posicaoFracionario))
+            return nullptr;
+    }
 
-    for (std::vector<double>::size_type i = 0 ; i < A.size() ; i++) // Coloca 0 para representar a variável de folga nas demais restrições
-        A[i].push_back(0);    
+    /* A solução do nó não muda, pois apenas o limite oposto ao de cada variável não básica fixada se aproxima, e os filhos herdam os novos limites.
+       Um intervalo vazio, possível em limites fracionários, indica que a sub-árvore não supera a incumbente */
 
-    C.push_back(0); // Coloca 0 para representar a variável de folga na função objetivo
-    A.push_back(novaRestricao);
+    if (aplicaFixacao(problema, problema.calculaFixacaoCustos(numVariaveisCanonica, incumbente.getValor())) > 0 &&
+        deveRealizarPoda(problema, incumbente, solucao, solucaoOtimaTeste, posicaoFracionario))
+        return nullptr;
 
-    auto preparacao = retornaPreparacaoSimplex(A, A.size(), A[0].size(), numVariaveisCanonica); // Prepará para o método de duas fases, se necessário
-    ondeAdicionar = preparacao.ondeAdicionar;
+    posicaoFracionario = ramificacao->escolheVariavel(problema, solucao, 1); // As demais threads estão ocupadas com outros nós
 
-    int tamanhoColuna = A[0].size();
+    problema.setTipoPoda(0); // 0 = não encerrou
 
-    ElementosOriginais e = {realizaCopiaProfunda(A), realizaCopiaProfunda(B), realizaCopiaProfunda(C)}; // Cópia do problema antes da resolução para ser replicado nos nós filhos
+    int primeiroFilho = problema.aumentaQuantidadeProblemas(); // Mais dois novos problemas surgirão, com IDs reservados atomicamente
+    int divisoes[2] = {primeiroFilho, primeiroFilho + 1}; // Ramificações desse problema
+    problema.setDivisoesProblema(divisoes); // Guarda a informação das ramificações desse nó
 
-    adicionaVariaveisArtificiais(A, C, tamanhoColuna, A.size(), preparacao);
+    registraEncerrado(problema, posicaoFracionario, std::floor(solucao[posicaoFracionario])); // Coloca na marcação de encerramento
+
+    return criaNovosProblemas(problema, posicaoFracionario, solucao, incumbente, divisoes);    
+}
+
+SimplexInteiro retornaProblema(const SimplexInteiro &pai, std::vector<double> solucao, int posicaoNaoInteiro, bool eMenor)
+{
+    SimplexInteiro p(pai); // O filho parte do tableau final do pai
+    double fracao = solucao[posicaoNaoInteiro] - std::floor(solucao[posicaoNaoInteiro]);
+
+    p.setRamo({posicaoNaoInteiro, !eMenor, eMenor ? fracao : 1 - fracao});
+
+    if (eMenor) // Se a restrição é <=, o limite é o piso do valor da coordenada
+        p.adicionaRamificacao(posicaoNaoInteiro, std::floor(solucao[posicaoNaoInteiro]), true);
+
+    else // Se a restrição é >=, o limite é o piso do valor da coordenada acrescido de 1
+        p.adicionaRamificacao(posicaoNaoInteiro, std::floor(solucao[posicaoNaoInteiro]) + 1, false);
 
-    SimplexInteiro p(A, B, C, tipoProblema, preparacao.eDuasFases, preparacao.numVarArtificiais, numVariaveisCanonica, e);   
-    
     return p;
 }
 
-void criaNovosProblemas(std::vector<std::vector<double>> A, std::vector<double> B, std::vector<double> C, int posicaoNaoInteiro, bool tipoProblema, std::vector<double> solucao, double &solucaoOtimaGlobal, std::vector<double> &solucaoGlobal, int divisoes[2])
+/**
+ * @brief Retorna um dos nós abertos da ramificação, com os limites alterados do pai e o limite da ramificação, sem copiar o tableau
+ * 
+ * @param pai O problema do nó pai, já resolvido
+ * @param solucao As coordenadas da solução do pai
+ * @param posicaoNaoInteiro A coordenada que tem um valor fracionário
+ * @param eMenor true se é uma restrição menor ou igual que, false se é maior ou igual que
+ * @return NoAberto O nó, ainda sem o identificador e os dados de seleção
+ */
+
+static NoAberto retornaNoAberto(const SimplexInteiro &pai, const std::vector<double> &solucao, int posicaoNaoInteiro, bool eMenor)
 {
-    /* Cópia dos elementos, pois a criação de p1 irá modificar. */
-    auto aOriginal = realizaCopiaProfunda(A);
-    auto bOriginal = realizaCopiaProfunda(B);
-    auto cOriginal = realizaCopiaProfunda(C);
+    double limite = std::floor(solucao[posicaoNaoInteiro]) + (eMenor ? 0 : 1); // O mesmo arredondamento de retornaProblema
 
-    /* Vetores contendo os índices das linhas com variáveis artificiais, que serão repassados para a resolução do problema */
-    std::vector<int> ondeAdicionarP1;
-    std::vector<int> ondeAdicionarP2;
+    double fracao = solucao[posicaoNaoInteiro] - std::floor(solucao[posicaoNaoInteiro]);
 
-    /* Cria os problemas */
-    
-    SimplexInteiro p1 = retornaProblema(A, B, C, solucao, posicaoNaoInteiro, tipoProblema, true, ondeAdicionarP1);
-    SimplexInteiro p2 = retornaProblema(aOriginal, bOriginal, cOriginal, solucao, posicaoNaoInteiro, tipoProblema, false, ondeAdicionarP2);    
+    NoAberto no;
+
+    no.ramo = {posicaoNaoInteiro, !eMenor, eMenor ? fracao : 1 - fracao};
+    no.alteracoes = pai.getAlteracoes();
+    registraAlteracao(no.alteracoes, pai.calculaRamificacao(posicaoNaoInteiro, limite, eMenor));
+
+    return no;
+}
+
+/**
+ * @brief Soma das distâncias de cada coordenada ao inteiro mais próximo
+ * 
+ */
+
+static double somaInviabilidades(const std::vector<double> &solucao)
+{
+    double soma = 0;
+
+    for (double valor : solucao)
+        soma += std::fabs(valor - std::round(valor));
+
+    return soma;
+}
+
+/**
+ * @brief Estima o melhor valor inteiro na sub-árvore de um nó pela projeção a partir da raiz: cada unidade de inviabilidade inteira
+ * custa, em média, a diferença entre o limite da raiz e a solução incumbente dividida pela inviabilidade da raiz.
+ * Sem solução incumbente, cada unidade de inviabilidade custa uma unidade do objetivo.
+ * 
+ * @param limite O valor da relaxação linear do nó, no objetivo interno
+ * @param inviabilidade A soma das inviabilidades inteiras da solução do nó
+ * @param incumbente A solução incumbente
+ * @return double A estimativa, no objetivo interno
+ */
+
+static double estimaSolucaoInteira(double limite, double inviabilidade, const Incumbente &incumbente)
+{
+    double valorIncumbente = incumbente.getValor();
+    double custoUnitario = 1;
+
+    if (valorIncumbente != -std::numeric_limits<double>::infinity() && inviabilidadeRaiz > 0)
+        custoUnitario = std::max(limiteRaiz - valorIncumbente, 0.0) / inviabilidadeRaiz;
+
+    return limite - custoUnitario * inviabilidade;
+}
+
+std::unique_ptr<SimplexInteiro> criaNovosProblemas(const SimplexInteiro &pai, int posicaoNaoInteiro, std::vector<double> solucao, Incumbente &incumbente,
+                                                    int divisoes[2])
+{
+    /* Os filhos ainda não foram resolvidos, então a prioridade deles na fila vem do pai */
+
+    int idPai = pai.getNumeroProblema(false);
+    double limitePai = pai.getSolucaoOtima();
+    double estimativa = estimaSolucaoInteira(limitePai, somaInviabilidades(solucao), incumbente);
+
+    nosPendentes.fetch_add(2, std::memory_order_relaxed); // Os filhos são contados antes de ficarem visíveis para as outras threads
+    acompanhamento.adicionaNo(divisoes[0], limitePai);
+    acompanhamento.adicionaNo(divisoes[1], limitePai);
 
     /* Os IDs dos problemas são os fornecidos para a função, já que a concorrência entre as threads prejudica o mapeamento correto. */
-    p1.setNumeroProblema(divisoes[0]);
-    p2.setNumeroProblema(divisoes[1]);
 
-    mutexProblemas.lock();
-    problemasExecutando += 2; // Aumenta a quantidade de problemas em aberto
-    mutexProblemas.unlock();
+    if (fila.getRegra() == RegraSelecaoNo::MERGULHO)
+    {
+        /* Mergulha no filho do lado para o qual a variável seria arredondada, partindo do tableau do pai, e empilha o irmão para o retrocesso ou para o roubo */
 
-    std::unique_lock<std::mutex> mutexUnico(mutexFila); // Trava para colocar problemas na fila
+        bool mergulhaAcima = solucao[posicaoNaoInteiro] - std::floor(solucao[posicaoNaoInteiro]) >= 0.5;
+        std::unique_ptr<SimplexInteiro> mergulho(new SimplexInteiro(retornaProblema(pai, solucao, posicaoNaoInteiro, !mergulhaAcima)));
+        NoAberto irmao = retornaNoAberto(pai, solucao, posicaoNaoInteiro, mergulhaAcima);
 
-    /* Coloca na fila para busca em largura */
+        mergulho->setNumeroProblema(divisoes[mergulhaAcima ? 1 : 0]);
+        mergulho->setPai(idPai);
+        mergulho->setDadosSelecao(pai.getProfundidade() + 1, limitePai, estimativa);
 
-    fila.push({p1, ondeAdicionarP1});
-    fila.push({p2, ondeAdicionarP2});
+        irmao.idProblema = divisoes[mergulhaAcima ? 0 : 1];
+        irmao.idPai = idPai;
+        irmao.profundidade = pai.getProfundidade() + 1;
+        irmao.limitePai = limitePai;
+        irmao.estimativa = estimativa;
 
-    temElemento.notify_one(); // Notifica que há problema na fila
+        publicaNo(std::move(irmao));
+
+        return mergulho;
+    }
+
+    /* Coloca na fila de nós abertos. Na busca em profundidade, o filho do limite superior é o próximo a ser resolvido */
+
+    for (int k = 0 ; k < 2 ; k++)
+    {
+        NoAberto no = retornaNoAberto(pai, solucao, posicaoNaoInteiro, k == 0);
+
+        no.idProblema = divisoes[k];
+        no.idPai = idPai;
+        no.profundidade = pai.getProfundidade() + 1;
+        no.limitePai = limitePai;
+        no.estimativa = estimativa;
+
+        publicaNo(std::move(no));
+    }
+
+    return nullptr;
 }
 
-void iniciaProblemaInteiro(Simplex simplex, std::vector<std::vector<double>> aOriginal, std::vector<double> bOriginal, std::vector<double> cOriginal, int numVars)
+/**
+ * @brief Cria os deques e a ordem de roubo de cada thread. Cada thread rouba primeiro das threads do seu nó NUMA e depois das demais,
+ * começando pela vizinha, para espalhar os roubos
+ * 
+ */
+
+static void preparaRoubo(const std::vector<AfinidadeThread> &afinidades)
 {
-    SimplexInteiro simplexInteiro(simplex, aOriginal, bOriginal, cOriginal); // Inicialização do problema inteiro através do problema original resolvido
-    double solucaoOtimaGlobal; // Variável referência para a solução inteira
-    std::vector<double> solucaoGlobal(numVars, 0); // Vetor de solução inteira incumbente
-    std::vector<double> solucao(numVars, 0); // Vetor de solução do problema original
-    std::vector<std::pair<int, double>> base = simplexInteiro.getBase(); // Variáveis básicas do problema original após a resolução
+    deques.clear();
+    ordemRoubo.assign(numThreads, {});
+
+    for (int i = 0 ; i < numThreads ; i++)
+    {
+        deques.emplace_back(new DequeTrabalho());
+
+        for (int mesmoNo = 1 ; mesmoNo >= 0 ; mesmoNo--)
+        {
+            for (int d = 1 ; d < numThreads ; d++)
+            {
+                int vitima = (i + d) % numThreads;
+
+                if ((afinidades[vitima].noNuma == afinidades[i].noNuma) == (mesmoNo == 1))
+                    ordemRoubo[i].push_back(vitima);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Libera os nós que ficaram abertos na fila e nos deques após uma interrupção. Todas as threads já terminaram
+ * 
+ */
+
+static void descartaNosAbertos()
+{
+    while (!fila.vazia())
+        fila.retira();
+
+    for (auto &deque : deques)
+    {
+        while (NoAberto *no = deque->retira())
+            delete no;
+    }
+
+    nosPendentes = 0;
+}
+
+std::vector<double> iniciaProblemaInteiro(Simplex simplex, int numVars, const MatrizEsparsa &restricoes, const std::vector<double> &b,
+                                            const std::vector<double> &c, const Configuracao &configuracao)
+{
+    SimplexInteiro simplexInteiro(simplex); // Inicialização do problema inteiro através do problema original resolvido
+    Incumbente incumbente(numVars); // Solução inteira incumbente no objetivo interno. Qualquer solução inteira supera a inicial, de valor -infinito
+    std::vector<double> solucao = simplexInteiro.getSolucao(numVars); // Vetor de solução do problema original
     numVariaveisCanonica = numVars; // Número de variáveis na forma canônica para uso de todas as funções
 
     if (simplexInteiro.getSemSolucao() || simplexInteiro.getEIlimitado()) // Não há o que analisar, encerramos
     {
         std::cout << "O problema original não possui solução ou é ilimitado.\n" << std::endl;
-        return;
+        return {};
     }
 
-    inicializaPonteirosComparacao(simplexInteiro, solucaoOtimaGlobal);  // Inicializa os ponteiros de função para comparação de solução conforme tipo do problema  
-
-    int posicaoFracionario = testaSolucaoOriginal(base, solucao, numVars); // Verifica se a solução original é inteira através do índice retornado
+    int posicaoFracionario = testaSolucaoOriginal(solucao); // Verifica se a solução original é inteira através do índice retornado
 
     if (posicaoFracionario == -1) // Se -1, ela é inteira. Encerramos
-        return;
+        return solucao;
     
     /* Caso contrário, iremos ramificar o problema original em busca da solução inteira e iniciar o Branch and Bound */
 
-    int idsPrimeiroNos[] = {1, 2};
-    simplexInteiro.aumentaQuantidadeProblemas();
-    criaNovosProblemas(simplexInteiro.getMatrizAOriginal(), simplexInteiro.getVetorBOriginal(), simplexInteiro.getVetorCOriginal(),
-                        posicaoFracionario, simplexInteiro.getTipoProblema(), solucao, solucaoOtimaGlobal, solucaoGlobal, idsPrimeiroNos);
+    numThreads = configuracao.numThreads > 0 ? configuracao.numThreads : contaNucleosDisponiveis();
+
+    std::vector<AfinidadeThread> afinidades = planejaAfinidade(numThreads, configuracao.afinidade);
 
-    /* Cria as 5 threads que irão concorrer pelos problemas na fila, realizando a busca em largura */
+    fila.defineRegra(configuracao.selecao);
+    fim = false;
+    preparaRoubo(afinidades);
+    acompanhamento.inicia(configuracao, numThreads, simplexInteiro.getTipoProblema()); // O tempo conta a partir dos cortes e das heurísticas da raiz
 
-    for (int i = 0 ; i < 5 ; i++)
+    if (!registroArvore.abre(configuracao.logArvore, numThreads))
     {
-        threads.push_back(std::thread(controlaProblemasInteiros, std::ref(solucaoOtimaGlobal), std::ref(solucaoGlobal)));
-        if (!threads[i].joinable())
+        std::cout << "Não foi possível criar o registro da árvore" << (configuracao.logArvore.empty() ? "" : " em " + configuracao.logArvore) << ".\n";
+        exit(1);
+    }
+
+    profundidadeCortes = configuracao.profundidadeCortes;
+
+    if (configuracao.rodadasCortes > 0 || profundidadeCortes > 0)
+    {
+        estruturaBinaria.reset(new EstruturaBinaria(simplexInteiro, numVars, restricoes, b));
+
+        if (estruturaBinaria->getNumMochilas() == 0)
+            estruturaBinaria.reset();
+        else
+            std::cout << "Estrutura binária: " << estruturaBinaria->getNumMochilas() << " restrições de mochila e " << estruturaBinaria->getNumConflitos() << " conflitos.\n";
+    }
+
+    if (configuracao.rodadasCortes > 0) // Os cortes fortalecem a relaxação da raiz, e todos os nós são reconstruídos a partir dela
+    {
+        double relaxacao = simplexInteiro.getSolucaoOtima();
+        int numCortes = aplicaCortesRaiz(simplexInteiro, numVars, configuracao.rodadasCortes, estruturaBinaria.get());
+
+        if (simplexInteiro.getSemSolucao())
+            std::cout << "Os cortes tornaram a relaxação da raiz inviável: o problema não possui solução inteira.\n";
+
+        else if (numCortes > 0)
         {
-            std::cout << "Ocorreu um erro ao criar a thread " << i + 1 << std::endl; 
-            exit(1);
+            double valor = simplexInteiro.getSolucaoOtima();
+
+            std::cout << "Cortes na raiz: " << numCortes << " cortes, relaxação de " << (!simplexInteiro.getTipoProblema() && relaxacao != 0 ? relaxacao * -1 : relaxacao)
+                << " para " << (!simplexInteiro.getTipoProblema() && valor != 0 ? valor * -1 : valor) << ".\n";
         }
+
+        solucao = simplexInteiro.getSolucao(numVars);
+        simplexInteiro.setDadosSelecao(0, simplexInteiro.getSolucaoOtima(), simplexInteiro.getSolucaoOtima());
     }
 
-    for (int i = 0 ; i < 5 ; i++)
-        threads[i].join();
+    limiteRaiz = simplexInteiro.getSolucaoOtima();
+    inviabilidadeRaiz = somaInviabilidades(solucao);
 
-    /* Exibe os resultados encontrados */
+    raiz = &simplexInteiro;
+    simplexInteiro.setNumeroProblema(0); // A raiz não é registrada, e os seus filhos são os problemas 1 e 2
 
-    imprimeSolucaoInteiraFinal(solucaoOtimaGlobal, solucaoGlobal, numVars);
-}
+    if (simplexInteiro.getSemSolucao()) // Sem solução inteira, a incumbente permanece vazia
+        posicaoFracionario = -1;
 
-void inicializaPonteirosComparacao(SimplexInteiro simplexInteiro, double &solucaoOtimaGlobal)
-{
-    if (simplexInteiro.getTipoProblema()) // O problema é de maximização
+    else if ((posicaoFracionario = retornaPosicaoNaoInteiro(solucao)) == -1) // Os cortes tornaram a solução da raiz inteira, e não há o que ramificar
     {
-        solucaoOtimaGlobal = -simplexInteiro.getSolucaoOtima(); // O referencial pode ser inicializado com qualquer valor menor ou igual a solução ótima original
-        comparaSolucoesInclusive = [](double num1, double num2){ return num1 <= num2; }; // Expressão que testa a solução incumbente e a solução inteira encontrada
-        comparaSolucoesExclusive = [](double num1, double num2){ return num1 < num2; }; // Expressão que testa a solução incumbente e a solução encontrada visando a poda.
+        for (double &valor : solucao)
+            valor = std::round(valor);
+
+        incumbente.atualiza(simplexInteiro.getSolucaoOtima(), solucao);
     }
 
-    else // O problema é de minimização
+    frequenciaHeuristicas = configuracao.frequenciaHeuristicas;
+
+    if (posicaoFracionario != -1 && frequenciaHeuristicas > 0) // Uma incumbente desde o início permite as podas pelo limite nos primeiros nós
     {
-        solucaoOtimaGlobal = simplexInteiro.getSolucaoOtima(); // O referencial para minimização é a solução atual. Nenhuma solução nova pode ser maior.
-        comparaSolucoesInclusive = [](double num1, double num2){ return num1 >= num2; };
-        comparaSolucoesExclusive = [](double num1, double num2){ return num1 > num2; };
+        heuristicas.reset(new Heuristicas(simplexInteiro, numVars, restricoes, b, c));
+        aplicaHeuristicasRaiz(simplexInteiro, solucao, incumbente);
     }
-}
 
-int testaSolucaoOriginal(std::vector<std::pair<int, double>> base, std::vector<double> &solucao, int numVars)
-{
-    /* Segue a mesma estratégia da função verificaSolucaoInteira */
-    
-    for (std::vector<double>::size_type i = 0 ; i < base.size() ; i++)
+    if (posicaoFracionario != -1) // Com uma incumbente das heurísticas, a fixação na raiz vale para todos os nós, reconstruídos a partir dela
     {
-        if (base[i].first < numVars)
-            solucao[base[i].first] = base[i].second;
+        int fixadas = aplicaFixacao(simplexInteiro, simplexInteiro.calculaFixacaoCustos(numVars, incumbente.getValor()));
+
+        if (simplexInteiro.getSemSolucao()) // Nenhuma solução inteira supera a incumbente
+        {
+            std::cout << "Fixação por custos reduzidos na raiz: nenhuma solução supera a incumbente.\n";
+            posicaoFracionario = -1;
+        }
+
+        else if (fixadas > 0)
+            std::cout << "Fixação por custos reduzidos na raiz: " << fixadas << " variáveis com limites apertados.\n";
+    }
+
+    if (posicaoFracionario != -1)
+    {
+        pseudoCustos.reset(new PseudoCustos(numVars));
+        propagacao.reset(new Propagacao(simplexInteiro, numVars, restricoes, b));
+        ramificacao = criaEstrategiaRamificacao(configuracao.ramificacao, *pseudoCustos);
+        posicaoFracionario = ramificacao->escolheVariavel(simplexInteiro, solucao, numThreads); // As threads ainda não existem e podem avaliar as candidatas da raiz
+
+        int idsPrimeiroNos[] = {1, 2};
+        simplexInteiro.aumentaQuantidadeProblemas();
+        std::unique_ptr<SimplexInteiro> filho = criaNovosProblemas(simplexInteiro, posicaoFracionario, solucao, incumbente, idsPrimeiroNos);
+
+        if (filho) // No mergulho, o filho escolhido na raiz vai para o topo da pilha da thread 0, acima do irmão, pois as threads ainda não existem
+            publicaNo({filho->getNumeroProblema(false), filho->getPai(), filho->getProfundidade(), filho->getLimitePai(), filho->getEstimativa(), filho->getAlteracoes(), filho->getRamo()});
+
+        /* Cria as threads que irão concorrer pelos problemas na fila ou roubar os nós umas das outras */
+
+        bool fixacaoFalhou = false;
+
+        for (int i = 0 ; i < numThreads ; i++)
+        {
+            threads.push_back(std::thread(controlaProblemasInteiros, i, std::ref(incumbente)));
+            if (!threads[i].joinable())
+            {
+                std::cout << "Ocorreu um erro ao criar a thread " << i + 1 << std::endl; 
+                exit(1);
+            }
+
+            if (!aplicaAfinidade(threads[i], afinidades[i]))
+                fixacaoFalhou = true;
+        }
+
+        if (fixacaoFalhou) // A resolução continua, apenas sem a fixação
+            std::cout << "Não foi possível fixar as threads nos núcleos. As threads executarão sem afinidade.\n";
+
+        for (int i = 0 ; i < numThreads ; i++)
+            threads[i].join();
+
+        acompanhamento.imprimeResumo(incumbente);
+        descartaNosAbertos();
     }
 
+    /* Exibe os resultados encontrados */
+
+    std::vector<double> solucaoGlobal; // Vetor de solução inteira incumbente
+    double solucaoOtimaGlobal = incumbente.leSolucao(solucaoGlobal);
+
+    imprimeSolucaoInteiraFinal(solucaoOtimaGlobal, solucaoGlobal, simplexInteiro.getTipoProblema());
+
+    if (solucaoOtimaGlobal == -std::numeric_limits<double>::infinity()) // Sem solução inteira, não há coordenadas para o postsolve
+        return {};
+
+    return solucaoGlobal;
+}
+
+int testaSolucaoOriginal(std::vector<double> solucao)
+{
     int posicaoFracionario = retornaPosicaoNaoInteiro(solucao);
     
     if (posicaoFracionario == -1)
@@ -564,53 +1294,53 @@ int testaSolucaoOriginal(std::vector<std::pair<int, double>> base, std::vector<d
     return posicaoFracionario;
 }
 
-void imprimeSolucaoInteiraFinal(double solucaoOtimaGlobal, std::vector<double> solucaoGlobal, int numVars)
+void imprimeSolucaoInteiraFinal(double solucaoOtimaGlobal, std::vector<double> solucaoGlobal, bool tipoProblema)
 {
-    int contadorZero = 0;
-
-    std::sort(problemasEncerrados.begin(), problemasEncerrados.end(),
-                [](SimplexInteiro s1, SimplexInteiro s2){ return s1.getNumeroProblema(false) < s2.getNumeroProblema(false); });
-
     std::cout << std::endl;
 
-    for (auto p : problemasEncerrados)
-    {
-        std::cout << "Problema " << p.getNumeroProblema(false) << std::endl;
+    /* Os problemas encerrados de todas as threads são impressos à medida que são lidos do arquivo, na ordem de encerramento */
 
-        if (!p.getEIlimitado() && !p.getSemSolucao())
-        {            
-            std::cout << "====================================================\n" << std::endl;
+    bool registroCompleto = registroArvore.percorreRegistros([tipoProblema](const RegistroNo &p)
+    {
+        std::cout << "Problema " << p.idProblema << (p.idPai == 0 ? ", filho da raiz" : ", filho do problema " + std::to_string(p.idPai)) << std::endl;
+        std::cout << "====================================================" << std::endl;
 
-            p.realizaImpressaoFinal();
-        }
-        
-        else
-            std::cout << "====================================================" << std::endl;
+        if (p.resolvido)
+            std::cout << "Solução ótima da relaxação: " << (!tipoProblema && p.valor != 0 ? p.valor * -1 : p.valor) << std::endl;
 
         std::cout << std::endl;
 
-        if (p.getTipoPoda() == 0)
-            std::cout << "O problema " << p.getNumeroProblema(false) << " se dividiu nos problemas " << p.getDivisoesProblema()[0]
-                << " e " << p.getDivisoesProblema()[1] << std::endl << std::endl;
+        if (p.tipoPoda == 0)
+            std::cout << "O problema " << p.idProblema << " se dividiu nos problemas " << p.divisoes[0] << " (x" << p.variavel + 1 << " <= " << p.limite
+                << ") e " << p.divisoes[1] << " (x" << p.variavel + 1 << " >= " << p.limite + 1 << ")" << std::endl << std::endl;
         
-        else if (p.getTipoPoda() == 1)
-            std::cout << "O problema " << p.getNumeroProblema(false) << " encerrou por inviabilidade ou por limitação da solução.\n" << std::endl;
+        else if (p.tipoPoda == 1)
+            std::cout << "O problema " << p.idProblema << " encerrou por inviabilidade ou por limitação da solução.\n" << std::endl;
 
-        else if (p.getTipoPoda() == 2)
-            std::cout << "O problema " << p.getNumeroProblema(false) << " encerrou por ter solução inteira e melhor que a atual.\n" << std::endl;
+        else if (p.tipoPoda == 2)
+            std::cout << "O problema " << p.idProblema << " encerrou por ter solução inteira e melhor que a atual.\n" << std::endl;
 
-        else if (p.getTipoPoda() == 3)
-            std::cout << "O problema " << p.getNumeroProblema(false) << " encerrou por ter uma solução inteira, porém é pior que a atual.\n" << std::endl;
-    }
+        else if (p.tipoPoda == 3)
+            std::cout << "O problema " << p.idProblema << " encerrou por ter uma solução inteira, porém não é melhor que a atual.\n" << std::endl;
 
-    for (std::vector<double>::size_type i = 0 ; i < solucaoGlobal.size() ; i++)
+        else if (p.tipoPoda == 4)
+            std::cout << "O problema " << p.idProblema << " foi descartado sem resolução, pois o limite do pai não supera a solução atual.\n" << std::endl;
+
+        else if (p.tipoPoda == 5)
+            std::cout << "O problema " << p.idProblema << " foi interrompido durante o Simplex dual, pois o limite da relaxação ficou abaixo da solução atual.\n" << std::endl;
+    });
+
+    if (!registroCompleto)
+        std::cout << "Não foi possível gravar ou ler todo o registro da árvore. A listagem dos problemas está incompleta.\n" << std::endl;
+
+    if (solucaoOtimaGlobal == -std::numeric_limits<double>::infinity()) // A incumbente não foi modificada. Coordenadas nulas não bastam, pois podem ser a solução
     {
-        if (solucaoGlobal[i] == 0)
-            contadorZero++;
+        std::cout << "Nenhuma solução inteira foi encontrada para o problema.\n";
+        return;
     }
 
-    if (contadorZero == numVars) // Como o vetor é inicializado com zeros, se todas as coordenadas são 0, então ele não foi modificado. Atribuímos zero à solução ótima.
-        solucaoOtimaGlobal = 0;
+    if (!tipoProblema && solucaoOtimaGlobal != 0)
+        solucaoOtimaGlobal *= -1; // O objetivo interno é maximizado. Na minimização, o valor do problema é o negativo dele
 
     std::cout << "Solução ótima inteira para o problema: ";
 
@@ -8,31 +8,79 @@
  */
 
 #include "simplex.hpp"
+#include "../util/configuracao.hpp"
+#include "../util/matriz_esparsa.hpp"
+#include "incumbente.hpp"
 
 #include <vector>
 #include <algorithm>
 #include <cmath>
-#include <queue>
+#include <memory>
+#include <atomic>
 
 /**
- * @brief Estrutura de dados que contém a matriz A e os vetores B e C originais do problema, ou seja, antes da resolução.
+ * @brief Novos limites de uma variável em um nó, em relação aos limites da raiz, na escala interna do Simplex.
  * 
- * Para cada ramificação de um problema de programação linear inteira, devemos adicionar uma restrição ao problema do nó pai.
- * Como, ao resolvermos o problema do nó pai, perdemos as instâncias originais, devemos tê-las copiadas antes de aplicar a resolução.
  */
-typedef struct 
+
+typedef struct
+{
+    int variavel; // Índice da variável
+    double inferior; // Novo limite inferior
+    double superior; // Novo limite superior
+} AlteracaoLimite;
+
+/**
+ * @brief A ramificação do pai que criou um nó, usada para alimentar os pseudo-custos quando o nó é resolvido.
+ * 
+ */
+
+typedef struct
+{
+    int variavel; // Variável ramificada, -1 na raiz
+    bool acima; // true no ramo x >= piso + 1, false no ramo x <= piso
+    double distancia; // Distância do valor da variável no pai ao novo limite
+} RamoNo;
+
+/**
+ * @brief Um corte, a desigualdade coeficientes^T x >= lado sobre as colunas do problema fornecido ao Branch and Bound, as variáveis da forma
+ * canônica e as folgas, na escala interna do Simplex. Os cortes são válidos para todas as soluções inteiras, então valem em todos os nós.
+ * 
+ */
+
+typedef struct
 {
-    std::vector<std::vector<double>> A;
-    std::vector<double> B;
-    std::vector<double> C;
-} ElementosOriginais;
+    std::vector<double> coeficientes; // Coeficiente de cada coluna do problema fornecido
+    double lado; // Lado direito da desigualdade
+    double norma; // Norma euclidiana dos coeficientes
+    int idade; // Rodadas consecutivas em que o corte não esteve justo na solução da relaxação
+} Corte;
+
+/**
+ * @brief Um nó aberto do Branch and Bound, ainda não resolvido. Em vez do tableau, guarda apenas os limites alterados em relação à raiz,
+ * no máximo um por variável, então ocupa O(profundidade) de memória. O tableau é reconstruído a partir da raiz quando o nó é retirado.
+ * 
+ */
+
+typedef struct
+{
+    int idProblema; // Identificador do nó
+    int idPai; // Identificador do pai, 0 nos filhos da raiz
+    int profundidade; // Profundidade do nó na árvore
+    double limitePai; // Valor da relaxação linear do pai no objetivo interno, que limita o valor deste nó
+    double estimativa; // Estimativa do melhor valor inteiro na sub-árvore deste nó, no objetivo interno
+    std::vector<AlteracaoLimite> alteracoes; // Limites alterados em relação à raiz
+    RamoNo ramo; // A ramificação do pai que criou o nó
+} NoAberto;
 
 /**
  * @brief Classe que herda da classe Simplex, com modificações para a resolução do problema de programação linear inteiro.
  * 
  * Essa classe diferencia-se na necessidade de acessarmos os membros da mesma.
  * Logo, há a existência de métodos "get".
- * Precisamos, também, do mapeamento da matriz A e dos vetores B e C originais.
+ * Cada nó parte de uma base ótima, a do nó pai no mergulho ou a da raiz para os nós retirados da fila, com os limites das variáveis ramificadas alterados.
+ * Como essa base continua dualmente viável, o nó é resolvido pelo Simplex dual, sem primeira fase, e o tableau não cresce com a profundidade.
+ * Cada nó guarda os limites alterados em relação à raiz, que são tudo o que um nó aberto precisa guardar.
  * Para sabermos a quantidade de problemas existentes, há uma variável existente em todos os objetos dessa classe, e ele é incrementável a cada criação.
  * Os métodos da classe Simplex que realizam impressões na tela são modificados para imprimirem apenas os resultados finais, para evitar poluição na tela,
  * devido à grande quantidade de ramificações.
@@ -40,16 +88,18 @@ typedef struct
 class SimplexInteiro : public Simplex
 {
     private:
-        /* Membros do problema do nó pai */      
-        std::vector<std::vector<double>> aOriginal;
-        std::vector<double> bOriginal;
-        std::vector<double> cOriginal;
-
         int divisoesProblema[2]; // Guarda a informação de quais nós são filhos desse problema se ele ramificar
 
-        static int numTotalProblemas; // Total de problemas ramificados
+        static std::atomic<int> numTotalProblemas; // Total de problemas ramificados, incrementado pelas threads sem trava
         int idProblema; // Identificador deste problema
-        short int tipoPoda; // 0 = não ramificou, 1 = inviabilidade/ausência ou ilimitação da solução, 2 = solução inteira incumbente, 3 = solução inteira menor que a incumbente
+        int idPai; // Identificador do pai, 0 nos filhos da raiz
+        short int tipoPoda; // 0 = não ramificou, 1 = inviabilidade/ausência ou ilimitação da solução, 2 = solução inteira incumbente, 3 = solução inteira que não supera a incumbente, 4 = descartado pelo limite do pai antes da resolução, 5 = interrompido pelo corte do objetivo durante o Simplex dual
+        int profundidade; // Profundidade do nó na árvore, 0 na raiz
+        double limitePai; // Valor da relaxação linear do pai no objetivo interno, que limita o valor deste nó
+        double estimativa; // Estimativa do melhor valor inteiro na sub-árvore deste nó, no objetivo interno
+        std::vector<AlteracaoLimite> alteracoes; // Limites alterados em relação à raiz pelas ramificações até este nó
+        RamoNo ramo; // A ramificação do pai que criou este nó
+        int colunasOriginais; // Colunas do problema fornecido. As folgas dos cortes vêm em seguida, na ordem em que os cortes foram adicionados
 
         /* Sobrescrição das funções para não impressão de status em cada iteração, evitando poluição da tela */
         void imprimeInformacao(std::string informacao) override;
@@ -63,68 +113,158 @@ class SimplexInteiro : public Simplex
         /**
          * @brief Cria uma instância de SimplexInteiro. Utilizada ao analisarmos o problema de programação linear fracionário, pois essa classe contém métodos "get".
          * 
-         * @param s Objeto da classe Simplex que contém o problema fracionário original do usuário resolvido
-         * @param aOriginal Matriz A antes da resolução do problema
-         * @param bOriginal Vetor B antes da resolução do problema
-         * @param cOriginal vetor C antes da resolução do problema
+         * @param s Objeto da classe Simplex que contém o problema fracionário original do usuário resolvido, com o tableau final
+         */
+
+        SimplexInteiro(Simplex s);
+
+        /**
+         * @brief Aplica a restrição da ramificação, x_i <= limite ou x_i >= limite, como um novo limite da variável, tornando a solução atual inviável.
+         * 
+         * @param posicaoNaoInteiro A coordenada que tem um valor fracionário
+         * @param limite O arredondamento do valor da coordenada, na escala do problema fornecido
+         * @param eMenor true se é uma restrição menor ou igual que, false se é maior ou igual que
+         */
+
+        void adicionaRamificacao(int posicaoNaoInteiro, double limite, bool eMenor);
+
+        /**
+         * @brief Calcula os limites que a ramificação x_i <= limite ou x_i >= limite daria à variável, sem aplicá-los
+         * 
+         * @param posicaoNaoInteiro A coordenada que tem um valor fracionário
+         * @param limite O arredondamento do valor da coordenada, na escala do problema fornecido
+         * @param eMenor true se é uma restrição menor ou igual que, false se é maior ou igual que
+         * @return AlteracaoLimite Os novos limites da variável, na escala interna. O intervalo pode ficar vazio
+         */
+
+        AlteracaoLimite calculaRamificacao(int posicaoNaoInteiro, double limite, bool eMenor) const;
+
+        /**
+         * @brief Aplica limites alterados, como os de um nó aberto sobre o tableau da raiz, registrando-os neste nó
+         * 
+         * @param novas Os limites alterados
+         */
+
+        void aplicaAlteracoes(const std::vector<AlteracaoLimite> &novas);
+
+        const std::vector<AlteracaoLimite> &getAlteracoes() const { return alteracoes; }
+
+        /**
+         * @brief Marca o nó como inviável sem resolvê-lo, como quando a propagação dos limites mostra que uma restrição não pode ser satisfeita
+         * 
+         */
+
+        void declaraInviavel() { semSolucao = true; }
+
+        /**
+         * @brief Define o corte do objetivo do próximo Simplex dual: a resolução para assim que o objetivo, que limita o valor do nó,
+         * fica abaixo da incumbente por mais que a tolerância
+         * 
+         * @param valorIncumbente O valor da incumbente no objetivo interno, ou -infinito para resolver o nó até o fim
+         */
+
+        void defineCorteObjetivo(double valorIncumbente);
+
+        /**
+         * @brief Indica se a última resolução parou pelo corte do objetivo. A solução do nó não é viável, e o nó deve ser podado
+         * 
          */
 
-        SimplexInteiro(Simplex s, std::vector<std::vector<double>> aOriginal, std::vector<double> bOriginal, std::vector<double> cOriginal);
+        bool getObjetivoCortado() const { return objetivoCortado; }
 
         /**
-         * @brief Cria uma instância de SimplexInteiro. Utilizada para a criação de nós filhos, representando as ramificações.
+         * @brief Deriva os cortes de Gomory inteiros mistos das linhas do tableau cuja variável básica é da forma canônica e tem valor fracionário.
+         * As variáveis não básicas são medidas pela distância ao seu limite atual, e as da forma canônica com limite inteiro são tratadas como inteiras.
+         * As folgas dos cortes já adicionados são substituídas pela definição de cada corte, então os novos cortes ficam sobre as colunas originais.
          * 
-         * @param coeficientes Matriz de coeficientes do problema do nó pai com acréscimo de uma restrição do Branch and Bound
-         * @param b Vetor de soluções do problema do nó pai com acréscimo do arredondamento inferior da variável fracionária que causou a ramificação.
-         * @param c Vetor de coeficientes da função objetivo do problema do nó pai com acréscimo da variável de folga da nova restrição.
-         * @param tipoProblema Tipo do problema original
-         * @param eDuasFases Indica se esse novo problema realizará duas fases ou não
-         * @param numVarArtificiais O número de variáveis artificiais no novo problema
-         * @param numVars O número de variáveis na forma canônica
-         * @param e A estrutura de dados contendo os elementos do problema do nó pai mais as adições a matriz coeficientes e aos vetores B e C
+         * @param numVars Número de variáveis na forma canônica
+         * @param cortes Os cortes já adicionados, na ordem das suas folgas
+         * @return std::vector<Corte> Os cortes separados, violados pela solução atual
          */
-        SimplexInteiro(std::vector <std::vector<double>> coeficientes, std::vector<double> b, std::vector<double> c,
-                        bool tipoProblema, bool eDuasFases, int numVarArtificiais, int numVars, ElementosOriginais e);
+
+        std::vector<Corte> separaGomory(int numVars, const std::vector<Corte> &cortes) const;
+
+        /**
+         * @brief Adiciona um corte ao tableau. A solução atual pode violá-lo, e deve ser reotimizada com aplicaSimplex.
+         * 
+         * @param corte O corte
+         */
+
+        void adicionaCorte(const Corte &corte);
 
         /**
-         * @brief Retorna uma cópia da matriz A desse problema antes da resolução
+         * @brief Retorna o valor da folga de um corte na solução atual, nulo se a folga não é básica
          * 
-         * @return std::vector<std::vector<double>> A cópia da matriz A
+         * @param k A posição do corte, na ordem em que foram adicionados
          */
 
-        std::vector<std::vector<double>> getMatrizAOriginal();
+        double getFolgaCorte(int k) const;
 
         /**
-         * @brief Retorna uma cópia do vetor B desse problema antes da resolução
+         * @brief Remove um corte inativo do tableau. As folgas dos cortes seguintes deslocam-se uma posição.
          * 
-         * @return std::vector<double> A cópia do vetor B
+         * @param k A posição do corte, na ordem em que foram adicionados
+         * @return true Se o corte foi removido
+         * @return false Se a folga do corte não é básica, e o corte não pode ser removido sem alterar a base
          */
 
-        std::vector<double> getVetorBOriginal();
+        bool removeCorte(int k);
 
         /**
-         * @brief Retorna uma cópia do vetor C desse problema antes da resolução
+         * @brief Retorna os valores de todas as colunas do problema fornecido, na escala interna, sobre os quais os cortes são avaliados
          * 
-         * @return std::vector<double> A cópia do vetor C
          */
 
-        std::vector<double> getVetorCOriginal();
+        std::vector<double> getValoresColunas() const;
 
         /**
-         * @brief Retorna uma cópia do vetor de bases desse problema antes da resolução
+         * @brief Substitui o objetivo do nó mantendo a base, que continua viável. O nó deve ser reotimizado com aplicaSimplex,
+         * que passa ao Simplex primal.
          * 
-         * @return std::vector<std::pair<int, double>> A cópia do vetor de bases
+         * @param coeficientes Os coeficientes C do novo objetivo interno, -C^T x, na escala interna
          */
 
-        std::vector<std::pair<int, double>> getBase();
+        void defineObjetivo(const std::vector<double> &coeficientes);
 
         /**
-         * @brief Retorna a solução ótima desse problema
+         * @brief Calcula os limites implicados pelos custos reduzidos do nó resolvido. Uma variável da forma canônica não básica em um limite
+         * só pode se afastar dele enquanto a piora do objetivo, o custo reduzido vezes a distância, não passa da diferença entre o valor do nó
+         * e a incumbente. O novo limite é arredondado para um inteiro na escala do problema fornecido, e vale para toda a sub-árvore do nó.
+         * 
+         * @param numVars Número de variáveis na forma canônica
+         * @param valorIncumbente O valor da incumbente, no objetivo interno
+         * @return std::vector<AlteracaoLimite> Os novos limites das variáveis que se apertam, na escala interna. O intervalo pode ficar vazio
+         */
+
+        std::vector<AlteracaoLimite> calculaFixacaoCustos(int numVars, double valorIncumbente) const;
+
+        double getLimiteInferior(int j) const { return limiteInferior[j]; }
+
+        double getLimiteSuperior(int j) const { return limiteSuperior[j]; }
+
+        /**
+         * @brief Retorna o fator de escala de uma coluna: o valor da variável no problema fornecido é o fator vezes o valor interno
+         * 
+         */
+
+        double getEscalaColuna(int j) const { return valorDesescalonado(j, 1); }
+
+        /**
+         * @brief Retorna os valores das variáveis da forma canônica após a resolução, básicas ou não, na escala do problema fornecido
+         * 
+         * @param numVars Número de variáveis na forma canônica
+         * @return std::vector<double> Os valores das variáveis
+         */
+
+        std::vector<double> getSolucao(int numVars);
+
+        /**
+         * @brief Retorna a solução ótima desse problema no objetivo interno, que é sempre maximizado: na minimização, é o negativo do valor do problema
          * 
          * @return double A solução ótima do problema
          */
 
-        double getSolucaoOtima();
+        double getSolucaoOtima() const;
 
         /**
          * @brief Retorna o indicador de existência de solução do problema
@@ -150,7 +290,7 @@ class SimplexInteiro : public Simplex
          * @return false Se o problema é de minimização
          */
 
-        bool getTipoProblema();
+        bool getTipoProblema() const;
 
         /**
          * @brief Retorna o identificador desse problema ou a quantidade de problemas existentes até esse problema
@@ -158,7 +298,7 @@ class SimplexInteiro : public Simplex
          * @param deTodos true Se é desejado a quantidade de problemas existentes, false se deseja o identificador desse problema
          * @return int O identificador desse problema ou a quantidade de problemas existentes
          */
-        int getNumeroProblema(bool deTodos);
+        int getNumeroProblema(bool deTodos) const;
 
         /**
          * @brief Retorna os IDs das ramificações do problema
@@ -192,6 +332,22 @@ class SimplexInteiro : public Simplex
 
         void setDivisoesProblema(int divisoes[2]);
 
+        /**
+         * @brief Configura os dados utilizados na escolha do nó pela fila de nós abertos
+         * 
+         * @param profundidade A profundidade do nó na árvore
+         * @param limitePai O valor da relaxação linear do pai, no objetivo interno
+         * @param estimativa A estimativa do melhor valor inteiro na sub-árvore, no objetivo interno
+         */
+
+        void setDadosSelecao(int profundidade, double limitePai, double estimativa);
+
+        int getProfundidade() const { return profundidade; }
+
+        double getLimitePai() const { return limitePai; }
+
+        double getEstimativa() const { return estimativa; }
+
         /**
          * @brief Configura o ID desse problema
          * 
@@ -201,11 +357,26 @@ class SimplexInteiro : public Simplex
         void setNumeroProblema(int id);
 
         /**
-         * @brief Aumenta a quantidade de problemas criados em 2
+         * @brief Configura o ID do pai desse problema, usado no registro da árvore
          * 
+         * @param id O ID do pai, 0 se o pai é a raiz
          */
 
-        void aumentaQuantidadeProblemas();
+        void setPai(int id);
+
+        int getPai() const { return idPai; }
+
+        void setRamo(RamoNo ramo) { this->ramo = ramo; }
+
+        const RamoNo &getRamo() const { return ramo; }
+
+        /**
+         * @brief Aumenta a quantidade de problemas criados em 2, de forma atômica
+         * 
+         * @return int O ID do primeiro dos dois novos problemas
+         */
+
+        int aumentaQuantidadeProblemas();
 
         /**
          * @brief Imprime as matrizes finais chamando a função da classe Simplex
@@ -222,9 +393,9 @@ class SimplexInteiro : public Simplex
         void realizaImpressaoFinal() override;
 
         /**
-         * @brief Aplica o Simplex sem realizar as impressões de informação na tela
+         * @brief Restaura a viabilidade do nó com o Simplex dual, partindo da base ótima do nó pai, sem realizar as impressões de informação na tela
          * 
-         * @param ondeAdicionar 
+         * @param ondeAdicionar Não utilizado, pois os nós não possuem variáveis artificiais
          */
 
         void aplicaSimplex(std::vector<int> ondeAdicionar) override;
@@ -241,6 +412,7 @@ double (*retornaFuncaoComparacao(double solucaoOtima))(double valor);
 
 /**
  * @brief Testa se o número é inteiro com uma tolerância de 7 casas decimais.
+ * O erro numérico dos pivoteamentos pode deixar o valor ligeiramente acima ou abaixo do inteiro, então a tolerância é simétrica.
  * 
  * @param num O número a ser testado
  * @return true Se o número tem uma parte decimal maior que 10^7.
@@ -250,13 +422,16 @@ double (*retornaFuncaoComparacao(double solucaoOtima))(double valor);
 bool eInteiro(double num);
 
 /**
- * @brief Controla a fila de problemas a serem analisados, implementado com uma estratégia de busca em largura.
+ * @brief Controla a fila de problemas a serem analisados, na ordem definida pela regra de seleção de nós.
+ * Um nó cujo pai tem relaxação linear que não supera a solução incumbente é descartado sem ser resolvido.
+ * No mergulho, a thread continua no filho retornado pela ramificação até que ele seja podado, e só então volta ao seu deque
+ * ou rouba um nó de outra thread.
  * 
- * @param solucaoOtimaGlobal A solução ótima incumbente
- * @param solucaoGlobal As coordenadas da solução incumbente
+ * @param trabalhador O índice da thread
+ * @param incumbente A solução incumbente
  */
 
-void controlaProblemasInteiros(double &solucaoOtimaGlobal, std::vector<double> &solucaoGlobal);
+void controlaProblemasInteiros(int trabalhador, Incumbente &incumbente);
 
 /**
  * @brief Retorna a posição da primeira coordenada não inteira encontrada.
@@ -271,8 +446,7 @@ int retornaPosicaoNaoInteiro(std::vector<double> solucao);
  * @brief Verifica se irá encerrar a sub-árvore seguindo os critérios do Branch and Bound para Programação Linear Inteira
  * 
  * @param problema O problema do nó
- * @param solucaoOtimaGlobal A solução incumbente
- * @param solucaoGlobal Coordenadas da solução incumbente
+ * @param incumbente A solução incumbente, lida sem travas e atualizada se a solução atual é inteira e melhor
  * @param solucao Coordenadas da solução atual
  * @param solucaoOtimaTeste Solução ótima desse problema
  * @param posicaoFracionario Posição da primeira coordenada que não é inteira
@@ -280,101 +454,78 @@ int retornaPosicaoNaoInteiro(std::vector<double> solucao);
  * @return false Caso o nó não tenha sido podado. Ele será ramificado
  */
 
-bool deveRealizarPoda(SimplexInteiro problema, double &solucaoOtimaGlobal, std::vector<double> &solucaoGlobal, std::vector<double> solucao,
-                                        double solucaoOtimaTeste, int posicaoFracionario);
+bool deveRealizarPoda(SimplexInteiro &problema, Incumbente &incumbente, std::vector<double> solucao, double solucaoOtimaTeste, int posicaoFracionario);
 
 /**
  * @brief Realiza a poda da sub-árvore conforme a definição do método Branch and Bound ou cria novos problemas se há a possibilidade de encontrar a solução.
  * 
  * @param problema O problema do nó atual a ser analisado
- * @param solucaoOtimaGlobal A solução incumbente atual
- * @param solucaoGlobal As coordenadas da solução incumbente atual
+ * @param incumbente A solução incumbente atual
+ * @return std::unique_ptr<SimplexInteiro> No mergulho, o filho a ser resolvido em seguida pela mesma thread. Nulo se o nó foi podado ou se os filhos foram para a fila
  */
 
-void verificaSolucaoInteira(SimplexInteiro problema, double &solucaoOtimaGlobal, std::vector<double> &solucaoGlobal);
+std::unique_ptr<SimplexInteiro> verificaSolucaoInteira(SimplexInteiro &problema, Incumbente &incumbente);
 
 /**
  * @brief Retorna um dos problemas da ramificação a ser criada
  * 
- * @param A A matriz de coeficientes do nó pai
- * @param B O vetor B do nó pai
- * @param C O vetor C do nó pai
+ * @param pai O problema do nó pai, já resolvido
  * @param solucao As coordenadas da solução atual para a captura da variável fracionada, que será utilizada para a criação da nova restrição
  * @param posicaoNaoInteiro A coordenada que tem um valor fracionário
- * @param tipoProblema Tipo do problema fornecido pelo usuário
  * @param eMenor true se é uma restrição menor ou igual que, false se é maior ou igual que
- * @param ondeAdicionar Vetor com os índices das linhas contendo variáveis artificiais
- * @return SimplexInteiro O problema novo com a restrição adicionada
+ * @return SimplexInteiro O problema novo, com o tableau final do pai e o limite da variável alterado
  */
 
-SimplexInteiro retornaProblema(std::vector<std::vector<double>> A, std::vector<double> B, std::vector<double> C,
-                                std::vector<double> solucao, int posicaoNaoInteiro, bool tipoProblema, bool eMenor, std::vector<int> &ondeAdicionar);
+SimplexInteiro retornaProblema(const SimplexInteiro &pai, std::vector<double> solucao, int posicaoNaoInteiro, bool eMenor);
 
 /**
- * @brief Cria os dois problemas da ramificação e adiciona na fila para análise posterior na busca em largura
+ * @brief Cria os dois nós abertos da ramificação e adiciona na fila, com o limite do pai e a estimativa do valor inteiro, sem copiar o tableau.
+ * No mergulho, apenas o irmão vai para a fila, e o filho do lado do arredondamento da variável é retornado com uma cópia do tableau do pai.
  * 
- * @param A A matriz de coeficientes do nó pai
- * @param B O vetor B do nó pai
- * @param C O vetor C do nó pai
+ * @param pai O problema do nó pai, já resolvido
  * @param posicaoNaoInteiro A coordenada que tem um valor fracionário
- * @param tipoProblema Tipo do problema fornecido pelo usuário
  * @param solucao As coordenadas da solução atual para a captura da variável fracionada, que será utilizada para a criação da nova restrição
- * @param solucaoOtimaGlobal A solução incumbente atual
- * @param solucaoGlobal As coordenadas da solução incumbente atual
+ * @param incumbente A solução incumbente atual, usada na estimativa
+ * @param divisoes Os IDs reservados para os dois filhos
+ * @return std::unique_ptr<SimplexInteiro> O filho do mergulho, ou nulo se os dois filhos foram para a fila
  */
 
-void criaNovosProblemas(std::vector<std::vector<double>> A, std::vector<double> B, std::vector<double> C,
-                        int posicaoNaoInteiro, bool tipoProblema, std::vector<double> solucao, double &solucaoOtimaGlobal, std::vector<double> &solucaoGlobal, int divisoes[2]);
+std::unique_ptr<SimplexInteiro> criaNovosProblemas(const SimplexInteiro &pai, int posicaoNaoInteiro, std::vector<double> solucao, Incumbente &incumbente,
+                                                    int divisoes[2]);
 
 /**
  * @brief Realiza a verificação inicial para viabilidade do problema inteiro e o controle dos resultados finais
  * 
- * @param simplex Problema original do usuário já resolvido
- * @param aOriginal Cópia da matriz A do problema fornecido pelo usuário
- * @param bOriginal Cópia do vetor B do problema fornecido pelo usuário
- * @param cOriginal Cópia do vetor C do problema fornecido pelo usuário
+ * @param simplex Problema original do usuário já resolvido, com o tableau final
  * @param numVars Número de variáveis na forma canônica
+ * @param restricoes As restrições do problema resolvido, na escala interna e sem as variáveis artificiais
+ * @param b O vetor de soluções das restrições
+ * @param c O vetor de coeficientes da função objetivo, na escala interna. As variáveis artificiais, ao final, são ignoradas
+ * @param configuracao As opções de execução: a regra de escolha do próximo nó, o número de threads e a fixação delas
+ * @return std::vector<double> As coordenadas da solução inteira, ou vazio se o problema original não possui solução, é ilimitado ou não tem solução inteira
  */
 
-void iniciaProblemaInteiro(Simplex simplex, std::vector<std::vector<double>> aOriginal, std::vector<double> bOriginal, std::vector<double> cOriginal, int numVars);
-
-/**
- * @brief Inicializa os ponteiros que serão usados para comparar a solução incumbente com a solução do problema fornecido no instante
- * 
- * No problema de maximização, alteramos a solução incumbente se, e somente se, ela for menor que a solução nova encontrada.
- * Logo, precisamos da operação solucaoIncumbente < solucaoNova.
- * 
- * Já no de minimização, alteramos a solução incumbente se, e somente se, ela for maior que a solução nova encontrada.
- * Logo, precisamos da operação solucaoIncumbente > solucaoNova.
- * 
- * Para não criarmos funções diferentes ou utilização de desvios condicionais excessivos, basta utilizar um ponteiro de função
- * que é alterado conforme o tipo do problema fornecido pelo usuário. Assim, o código será genérico e utilizado via alteração do ponteiro.
- * 
- * @param simplexInteiro A instância do problema original adaptado para a classe SimplexInteiro
- * @param solucaoOtimaGlobal A variável para guardar a solução incumbente.
- */
-
-void inicializaPonteirosComparacao(SimplexInteiro simplexInteiro, double &solucaoOtimaGlobal);
+std::vector<double> iniciaProblemaInteiro(Simplex simplex, int numVars, const MatrizEsparsa &restricoes, const std::vector<double> &b,
+                                            const std::vector<double> &c, const Configuracao &configuracao);
 
 /**
  * @brief Verifica se a solução do problema original do usuário já é inteira.
  * 
- * @param base As variáveis básicas do problema original após a resolução
- * @param solucao Vetor para inicialização da solução do problema original
- * @param numVars Número de variáveis na forma canônica
+ * @param solucao Os valores das variáveis da forma canônica no problema original
  * @return int -1 se a solução é inteira ou a coordenada da primeira coordenada fracionária encontrada
  */
 
-int testaSolucaoOriginal(std::vector<std::pair<int, double>> base, std::vector<double> &solucao, int numVars);
+int testaSolucaoOriginal(std::vector<double> solucao);
 
 /**
- * @brief Imprime os resultados do problema inteiro
+ * @brief Imprime os resultados do problema inteiro, com a listagem dos problemas lida do registro da árvore em blocos, na ordem de encerramento:
+ * o pai, a ramificação e o valor da relaxação linear de cada nó
  * 
- * @param solucaoOtimaGlobal Solução ótima encontrada
+ * @param solucaoOtimaGlobal Solução ótima encontrada, no objetivo interno e com a constante do presolve, ou -infinito se não há solução inteira
  * @param solucaoGlobal Coordenadas inteiras da solução ótima
- * @param numVars Número de variáveis na forma canônica
+ * @param tipoProblema true se o problema é de maximização, false se é de minimização
  */
 
-void imprimeSolucaoInteiraFinal(double solucaoOtimaGlobal, std::vector<double> solucaoGlobal, int numVars);
+void imprimeSolucaoInteiraFinal(double solucaoOtimaGlobal, std::vector<double> solucaoGlobal, bool tipoProblema);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,505 @@
+#include <iostream>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <random>
+
+/**
+ * @file simplex_revisado.cpp
+ * @brief Implementa o método Simplex revisado de duas fases com a base em uma fatoração LU atualizada na forma produto.
+ *
+ * Seguimos as mesmas convenções da classe Simplex: o vetor C é a linha da função objetivo do tableau,
+ * a solução é ótima quando nenhum custo reduzido é negativo, e a coluna que entra na base é a de custo reduzido mais negativo.
+ * O vetor B guarda os valores das variáveis básicas, e o vetor C_artificial guarda os custos da primeira fase (1 nas artificiais).
+ */
+
+#include "simplex_revisado.hpp"
+#include "../util/vetorizacao.hpp"
+
+static const long long LIMITE_TABLEAU_DENSO = 1000000; // Número máximo de elementos para montarmos ou imprimirmos a matriz densa
+
+SimplexRevisado::SimplexRevisado(Matriz coeficientes, std::vector<double> b, std::vector<double> c, bool tipoProblema, bool eDuasFases,
+                                    int numVarArtificiais, int numVars, int frequenciaRefatoracao)
+    : SimplexRevisado(MatrizEsparsa(coeficientes), b, c, tipoProblema, eDuasFases, numVarArtificiais, numVars, frequenciaRefatoracao)
+{
+
+}
+
+SimplexRevisado::SimplexRevisado(MatrizEsparsa coeficientes, std::vector<double> b, std::vector<double> c, bool tipoProblema, bool eDuasFases,
+                                    int numVarArtificiais, int numVars, int frequenciaRefatoracao)
+    : Simplex(coeficientes.getLinhas(), coeficientes.getColunas(), b, c, tipoProblema, eDuasFases, numVarArtificiais, numVars)
+{
+    aEsparsa = std::move(coeficientes);
+    this->frequenciaRefatoracao = frequenciaRefatoracao;
+    bOriginal = b;
+}
+
+void SimplexRevisado::inicializaBase()
+{
+    std::vector<int> colunaUnitaria(linhas, -1); // Primeira coluna de folga ou artificial igual ao vetor unitário de cada linha
+
+    for (int j = colunas - 1 ; j >= numVars ; j--) // De trás para frente, para que a menor coluna prevaleça
+    {
+        int p = aEsparsa.inicioColuna(j);
+
+        if (aEsparsa.fimColuna(j) - p == 1 && aEsparsa.valorElemento(p) == 1)
+            colunaUnitaria[aEsparsa.linhaElemento(p)] = j;
+    }
+
+    base.clear();
+    eBasica.assign(colunas, false);
+
+    for (int i = 0 ; i < linhas ; i++)
+    {
+        if (colunaUnitaria[i] == -1)
+            throw std::runtime_error("O conjunto de vetores na base é insuficiente para a resolução do problema. Verifique a entrada.");
+
+        base.push_back( {colunaUnitaria[i], B[i]} );
+        eBasica[colunaUnitaria[i]] = true;
+    }
+
+    refatora();
+}
+
+void SimplexRevisado::refatora()
+{
+    std::vector<int> colunasBase(linhas);
+
+    for (int i = 0 ; i < linhas ; i++)
+        colunasBase[i] = base[i].first;
+
+    if (!fatoracao.fatora(aEsparsa, colunasBase))
+        throw std::runtime_error("A matriz básica tornou-se singular durante o Simplex revisado.");
+
+    B = bOriginal; // x_B = B^{-1} b, recalculado para eliminar o erro acumulado nas atualizações
+    fatoracao.ftran(B);
+
+    for (int i = 0 ; i < linhas ; i++)
+        base[i].second = B[i];
+}
+
+std::vector<double> SimplexRevisado::calculaCustosReduzidos(const std::vector<double> &custos)
+{
+    std::vector<double> multiplicadores(linhas);
+
+    for (int i = 0 ; i < linhas ; i++)
+        multiplicadores[i] = custos[base[i].first];
+
+    fatoracao.btran(multiplicadores); // y^T = c_B B^{-1}
+
+    std::vector<double> custosReduzidos(custos.begin(), custos.begin() + colunas);
+
+    for (int j = 0 ; j < colunas ; j++) // c_j - y^T a_j, percorrendo apenas os elementos não nulos de cada coluna
+        custosReduzidos[j] -= aEsparsa.produtoColuna(j, multiplicadores);
+
+    for (int i = 0 ; i < linhas ; i++)
+        custosReduzidos[base[i].first] = 0; // Elimina o erro numérico das variáveis básicas
+
+    if (!eDuasFases) // Na segunda fase, as variáveis artificiais não podem voltar para a base
+    {
+        for (int j = colunas - numVarArtificiais ; j < colunas ; j++)
+            custosReduzidos[j] = std::numeric_limits<double>::infinity();
+    }
+
+    return custosReduzidos;
+}
+
+double SimplexRevisado::calculaObjetivo(const std::vector<double> &custos)
+{
+    double objetivo = 0;
+
+    for (int i = 0 ; i < linhas ; i++)
+        objetivo -= custos[base[i].first] * B[i];
+
+    return objetivo;
+}
+
+std::vector<double> SimplexRevisado::calculaColunaTransformada(int coluna)
+{
+    std::vector<double> colunaTransformada;
+
+    aEsparsa.copiaColuna(coluna, colunaTransformada);
+    fatoracao.ftran(colunaTransformada);
+
+    return colunaTransformada;
+}
+
+void SimplexRevisado::atualizaPrecificacao(int linhaPivo, int colunaNumPivo, const std::vector<double> &colunaTransformada)
+{
+    DadosPivoteamento dados;
+    std::vector<double> linhaInversa(linhas, 0); // Linha r de B^{-1}
+    std::vector<double> linhaTableau(colunas); // Linha r do tableau, e_r^T B^{-1} A
+    std::vector<double> produtos;
+
+    linhaInversa[linhaPivo] = 1;
+    fatoracao.btran(linhaInversa);
+
+    for (int j = 0 ; j < colunas ; j++)
+        linhaTableau[j] = eBasica[j] ? 0 : aEsparsa.produtoColuna(j, linhaInversa);
+
+    linhaTableau[base[linhaPivo].first] = 1;
+
+    dados.entrada = colunaNumPivo;
+    dados.saida = base[linhaPivo].first;
+    dados.pivo = colunaTransformada[linhaPivo];
+    dados.linhaPivo = linhaTableau.data();
+    dados.normaColuna = 0;
+    dados.produtos = nullptr;
+    dados.n = colunas;
+
+    for (int i = 0 ; i < linhas ; i++)
+        dados.normaColuna += colunaTransformada[i] * colunaTransformada[i];
+
+    if (precificacao->usaProdutos()) // a_j^T B^{-T} α_q, o produto das colunas do tableau com a coluna que entra
+    {
+        std::vector<double> w(colunaTransformada);
+
+        fatoracao.btran(w);
+        produtos.resize(colunas);
+
+        for (int j = 0 ; j < colunas ; j++)
+            produtos[j] = eBasica[j] ? 0 : aEsparsa.produtoColuna(j, w);
+
+        dados.produtos = produtos.data();
+    }
+
+    precificacao->atualiza(dados);
+}
+
+void SimplexRevisado::realizaTrocaBase(int linhaPivo, int colunaNumPivo, const std::vector<double> &colunaTransformada)
+{
+    if (precificacao->usaLinhaPivo()) // Os pesos dependem da base anterior à troca
+        atualizaPrecificacao(linhaPivo, colunaNumPivo, colunaTransformada);
+
+    double passo = B[linhaPivo] / colunaTransformada[linhaPivo]; // Quanto a variável que entra aumenta
+
+    subtraiMultiplo(B.data(), colunaTransformada.data(), passo, linhas); // x_B = x_B - passo * B^{-1} a_q
+    B[linhaPivo] = passo;
+
+    eBasica[base[linhaPivo].first] = false;
+    eBasica[colunaNumPivo] = true;
+    base[linhaPivo].first = colunaNumPivo;
+
+    fatoracao.atualiza(linhaPivo, colunaTransformada);
+
+    if (fatoracao.getNumAtualizacoes() >= frequenciaRefatoracao)
+        refatora();
+
+    for (int i = 0 ; i < linhas ; i++)
+    {
+        base[i].second = B[i];
+
+        if (B[i] < -TOLERANCIA_VIABILIDADE) // Assim como no tableau, um valor básico negativo indica inviabilidade
+            semSolucao = true;
+    }
+
+    solucaoOtima = calculaObjetivo(C) + constanteObjetivo;
+
+    if (eDuasFases)
+        solucaoOtimaPrimeiraFase = calculaObjetivo(C_artificial);
+}
+
+bool SimplexRevisado::calculaIteracaoSimplex(int iteracao)
+{
+    std::vector<double> custosReduzidos = calculaCustosReduzidos(eDuasFases ? C_artificial : C);
+    int colunaNumPivo = escolheColunaEntrada(custosReduzidos.data(), colunas); // Mesmo critério de otimalidade da classe Simplex
+
+    if (colunaNumPivo == -1)
+        return true;
+
+    std::vector<double> colunaTransformada = calculaColunaTransformada(colunaNumPivo);
+    std::vector<double> candidatosPivo(linhas); // Apenas coeficientes acima da tolerância participam do teste da razão
+
+    for (int i = 0 ; i < linhas ; i++)
+        candidatosPivo[i] = colunaTransformada[i] > TOLERANCIA_PIVO ? colunaTransformada[i] : 0;
+
+    int linhaPivo = escolheLinhaRazao(candidatosPivo);
+
+    if (linhaPivo == -1)
+    {
+        eIlimitado = true;
+        imprimeInformacao("Solução ilimitada.\n\n");
+        return true;
+    }
+
+    int variavelSaida = base[linhaPivo].first;
+
+    realizaTrocaBase(linhaPivo, colunaNumPivo, colunaTransformada);
+
+    if (semSolucao)
+    {
+        imprimeInformacao("O problema não possui solucão.\n");
+        return true;
+    }
+
+    imprimeInformacao("Iteração " + std::to_string(iteracao) + ": x" + std::to_string(colunaNumPivo + 1) + " entra na base e x"
+                        + std::to_string(variavelSaida + 1) + " sai. Solução do PPL");
+
+    if (eDuasFases)
+    {
+        imprimeInformacao(" auxiliar: ");
+        imprimeInformacao(solucaoOtimaPrimeiraFase);
+    }
+
+    else
+    {
+        imprimeInformacao(": ");
+        imprimeInformacao(!eMaximizacao && solucaoOtima != 0 ? solucaoOtima * -1 : solucaoOtima);
+    }
+
+    imprimeInformacao("\n");
+
+    return false;
+}
+
+void SimplexRevisado::removeArtificiaisDaBase()
+{
+    int primeiraArtificial = colunas - numVarArtificiais;
+
+    for (int r = 0 ; r < linhas ; r++)
+    {
+        if (base[r].first < primeiraArtificial)
+            continue;
+
+        std::vector<double> linhaInversa(linhas, 0); // Linha r de B^{-1}, para calcular a linha r do tableau
+
+        linhaInversa[r] = 1;
+        fatoracao.btran(linhaInversa);
+
+        for (int j = 0 ; j < primeiraArtificial ; j++)
+        {
+            if (eBasica[j])
+                continue;
+
+            double elemento = aEsparsa.produtoColuna(j, linhaInversa);
+
+            if (std::fabs(elemento) > 1e-9) // Pivoteamento degenerado: a artificial tem valor nulo, logo os demais valores não mudam
+            {
+                realizaTrocaBase(r, j, calculaColunaTransformada(j));
+                break;
+            }
+        }
+    }
+
+    semSolucao = false; // Os valores básicos não se alteram nos pivoteamentos degenerados acima
+}
+
+bool SimplexRevisado::realizaPrimeiraFase()
+{
+    bool fim = false;
+    int iteracao = 1;
+
+    while (!fim)
+    {
+        fim = calculaIteracaoSimplex(iteracao);
+        iteracao++;
+    }
+
+    imprimeInformacao("Fim da primeira fase.\n\n\n");
+
+    if (!semSolucao && std::fabs(solucaoOtimaPrimeiraFase) < 1e-6) // Mesma tolerância da classe Simplex
+    {
+        imprimeInformacao("O problema pode possuir alguma solução.\n\n");
+        imprimeInformacao("====================================================\n\n");
+        imprimeInformacao("Iniciando a segunda fase...\n\n\n");
+
+        removeArtificiaisDaBase();
+
+        C_artificial.clear();
+        eDuasFases = false;
+        reiniciaProgresso();
+
+        return true;
+    }
+
+    imprimeInformacao("O problema não possui solução.\n");
+    imprimeInformacao("====================================================\n\n");
+    semSolucao = true;
+
+    return false;
+}
+
+void SimplexRevisado::calculaTableauFinal()
+{
+    int colunasFinais = colunas - numVarArtificiais;
+    std::vector<double> custosReduzidos = calculaCustosReduzidos(C);
+
+    C.assign(custosReduzidos.begin(), custosReduzidos.begin() + colunasFinais);
+    colunas = colunasFinais;
+
+    limiteInferior.resize(colunas);
+    limiteSuperior.resize(colunas);
+    naSuperior.resize(colunas);
+    precificacao->redimensiona(colunas);
+
+    if ((long long) linhas * colunas <= LIMITE_TABLEAU_DENSO) // Problemas grandes e esparsos não cabem em um tableau denso
+        montaTableauDenso();
+}
+
+std::vector<double> SimplexRevisado::calculaNormasColunas()
+{
+    std::vector<double> normas(colunas, 0);
+
+    for (int j = 0 ; j < colunas ; j++) // A base inicial é a identidade, então as colunas do tableau são as originais
+    {
+        for (int p = aEsparsa.inicioColuna(j) ; p < aEsparsa.fimColuna(j) ; p++)
+            normas[j] += aEsparsa.valorElemento(p) * aEsparsa.valorElemento(p);
+    }
+
+    return normas;
+}
+
+void SimplexRevisado::montaTableauDenso()
+{
+    Matriz tableau(linhas, colunas, linhas);
+
+    for (int j = 0 ; j < colunas ; j++)
+    {
+        std::vector<double> colunaTransformada = calculaColunaTransformada(j);
+
+        for (int i = 0 ; i < linhas ; i++)
+            tableau[i][j] = colunaTransformada[i];
+    }
+
+    A = std::move(tableau);
+}
+
+void SimplexRevisado::garanteTableauFinal()
+{
+    if (!semSolucao && !eIlimitado && A.getLinhas() != linhas)
+        montaTableauDenso();
+}
+
+void SimplexRevisado::printMatrizA()
+{
+    if (A.getLinhas() == linhas && linhas > 0) // Tableau final já calculado
+    {
+        Simplex::printMatrizA();
+        return;
+    }
+
+    if ((long long) linhas * colunas > LIMITE_TABLEAU_DENSO)
+    {
+        std::cout << "Matriz A: " << linhas << " x " << colunas << " com " << aEsparsa.getNaoNulos() << " elementos não nulos (omitida)\n";
+        return;
+    }
+
+    std::cout << "Matriz A: \n";
+
+    for (int i = 0 ; i < linhas ; i++)
+    {
+        for (int j = 0 ; j < colunas ; j++)
+            std::cout << aEsparsa.elemento(i, j) << " | ";
+        std::cout << std::endl;
+    }
+}
+
+void SimplexRevisado::aplicaSimplex(std::vector<int> ondeAdicionar)
+{
+    int iteracao = 1;
+
+    if (eDuasFases)
+    {
+        C_artificial.assign(colunas - numVarArtificiais, 0); // Custos da primeira fase: 1 nas artificiais, 0 nas demais
+        C_artificial.resize(colunas, 1);
+    }
+
+    inicializaBase();
+    iniciaPrecificacao();
+
+    for (int i = 0 ; i < linhas ; i++)
+    {
+        if (B[i] < 0) // A base inicial deve ser viável
+            semSolucao = true;
+    }
+
+    solucaoOtima = calculaObjetivo(C) + constanteObjetivo;
+
+    imprimeInformacao("Aplicando o Simplex revisado com fatoração LU da base.\n\n");
+    imprimeInformacao("Matriz de coeficientes e vetores B e C iniciais: \n");
+    imprimeInformacao("====================================================\n");
+    printMatrizes();
+    imprimeInformacao("\n");
+
+    if (semSolucao)
+    {
+        imprimeInformacao("O problema não possui solucão.\n");
+        return;
+    }
+
+    if (eDuasFases)
+    {
+        imprimeInformacao("O método de duas fases deve ser aplicado. Iniciando primeira fase... \n\n\n");
+        solucaoOtimaPrimeiraFase = calculaObjetivo(C_artificial);
+
+        if (!realizaPrimeiraFase())
+            return;
+    }
+
+    bool fim = false;
+
+    if (perturbaB)
+        aplicaPerturbacao();
+
+    while (!fim)
+    {
+        fim = calculaIteracaoSimplex(iteracao);
+        iteracao++;
+    }
+
+    imprimeInformacao("\n");
+
+    if (!perturbacao.empty())
+        removePerturbacao();
+
+    if (!semSolucao && !eIlimitado)
+    {
+        calculaTableauFinal();
+
+        bool viavel = true;
+
+        for (int i = 0 ; i < linhas ; i++)
+            viavel = viavel && B[i] >= -TOLERANCIA_VIABILIDADE;
+
+        if (!viavel) // Inviabilidade deixada pela remoção da perturbação: o Simplex dual é aplicado sobre o tableau final
+        {
+            garanteTableauFinal();
+            realizaDualSimplex();
+        }
+    }
+
+    realizaImpressaoFinal();
+}
+
+void SimplexRevisado::aplicaPerturbacao()
+{
+    std::mt19937 gerador(linhas); // Mesma semente da classe Simplex, para que a execução seja reprodutível
+    std::uniform_real_distribution<double> distribuicao(0.5, 1);
+
+    perturbacao.resize(linhas);
+
+    for (int i = 0 ; i < linhas ; i++) // A perturbação é aplicada ao vetor B original, e os valores básicos são recalculados na refatoração
+    {
+        perturbacao[i] = PERTURBACAO_RELATIVA * (1 + std::fabs(bOriginal[i])) * distribuicao(gerador);
+        bOriginal[i] += perturbacao[i];
+    }
+
+    refatora();
+    solucaoOtima = calculaObjetivo(C) + constanteObjetivo;
+
+    imprimeInformacao("Vetor B perturbado para evitar pivoteamentos degenerados.\n\n");
+}
+
+void SimplexRevisado::removePerturbacao()
+{
+    for (int i = 0 ; i < linhas ; i++)
+        bOriginal[i] -= perturbacao[i];
+
+    perturbacao.clear();
+
+    refatora();
+    solucaoOtima = calculaObjetivo(C) + constanteObjetivo;
+
+    imprimeInformacao("Perturbação do vetor B removida.\n\n");
+}
@@ -0,0 +1,173 @@
+#ifndef SIMPLEX_REVISADO_H
+#define SIMPLEX_REVISADO_H
+
+/**
+ * @file simplex_revisado.hpp
+ * @brief Arquivo contendo a classe SimplexRevisado, que resolve o problema pelo método Simplex revisado com fatoração LU da base.
+ *
+ */
+
+#include <vector>
+
+#include "simplex.hpp"
+#include "../util/fatoracao_lu.hpp"
+#include "../util/matriz_esparsa.hpp"
+
+/**
+ * @brief Implementa o método Simplex revisado de duas fases.
+ *
+ * Ao contrário da classe Simplex, a matriz A nunca é pivoteada: ela mantém os coeficientes originais.
+ * A cada iteração, calculamos apenas os multiplicadores da base (BTRAN), os custos reduzidos, a coluna
+ * da variável que entra (FTRAN) e o teste da razão. A base é mantida em uma fatoração LU, atualizada na forma produto
+ * e refatorada periodicamente. Para problemas com muito mais variáveis que restrições, o custo de uma iteração
+ * cai de O(mn) para O(m² + nnz).
+ *
+ * A matriz de coeficientes é guardada apenas no formato esparso por colunas, então a memória e o custo do cálculo dos
+ * custos reduzidos são proporcionais ao número de elementos não nulos. Ao final, o tableau é calculado uma única vez e
+ * guardado nos membros da classe Simplex, para a impressão dos resultados, exceto quando ele seria grande demais.
+ */
+
+class SimplexRevisado : public Simplex
+{
+    private:
+        MatrizEsparsa aEsparsa; // Coeficientes originais das restrições, incluindo as variáveis artificiais
+        FatoracaoLU fatoracao; // Fatoração da matriz básica
+        std::vector<double> bOriginal; // Vetor B original, necessário para recalcular os valores básicos ao refatorar
+        std::vector<bool> eBasica; // Indica se cada variável está na base
+        int frequenciaRefatoracao; // Número de trocas de base entre duas refatorações
+
+        /**
+         * @brief Procura, para cada restrição, uma coluna de folga ou artificial que seja um vetor unitário, formando a base inicial identidade.
+         *
+         */
+
+        void inicializaBase();
+
+        /**
+         * @brief Refatora a base e recalcula os valores das variáveis básicas.
+         *
+         */
+
+        void refatora();
+
+        /**
+         * @brief Calcula os custos reduzidos c_j - y^T a_j de todas as colunas, com y = c_B B^{-1}.
+         *
+         * @param custos O vetor de custos da fase atual
+         * @return std::vector<double> Os custos reduzidos. As variáveis básicas recebem 0 e as proibidas de entrar na base recebem infinito.
+         */
+
+        std::vector<double> calculaCustosReduzidos(const std::vector<double> &custos);
+
+        /**
+         * @brief Calcula o valor da função objetivo, seguindo a convenção da classe Simplex (-c_B x_B).
+         *
+         * @param custos O vetor de custos da fase desejada
+         * @return double O valor da função objetivo
+         */
+
+        double calculaObjetivo(const std::vector<double> &custos);
+
+        /**
+         * @brief Retorna a coluna da matriz A transformada pela base, B^{-1} a_j
+         *
+         * @param coluna O índice da coluna
+         * @return std::vector<double> A coluna transformada
+         */
+
+        std::vector<double> calculaColunaTransformada(int coluna);
+
+        /**
+         * @brief Troca a variável básica de uma linha, atualizando os valores básicos e a fatoração.
+         *
+         * @param linhaPivo A linha da variável que sai da base
+         * @param colunaNumPivo A variável que entra na base
+         * @param colunaTransformada A coluna transformada da variável que entra
+         */
+
+        void realizaTrocaBase(int linhaPivo, int colunaNumPivo, const std::vector<double> &colunaTransformada);
+
+        /**
+         * @brief Fornece à estratégia de precificação a linha pivô, calculada por uma BTRAN, e, se necessário, os produtos
+         * das colunas com a coluna que entra, calculados por uma segunda BTRAN.
+         *
+         * @param linhaPivo A linha da variável que sai da base
+         * @param colunaNumPivo A variável que entra na base
+         * @param colunaTransformada A coluna transformada da variável que entra
+         */
+
+        void atualizaPrecificacao(int linhaPivo, int colunaNumPivo, const std::vector<double> &colunaTransformada);
+
+        void removeArtificiaisDaBase() override;
+
+        /**
+         * @brief Calcula o tableau final B^{-1} A, sem as variáveis artificiais, e o guarda nos membros da classe Simplex.
+         * Para problemas grandes, apenas os custos reduzidos são guardados e a matriz A permanece vazia.
+         *
+         */
+
+        void calculaTableauFinal();
+
+        /**
+         * @brief Calcula a matriz densa B^{-1} A das colunas finais e a guarda na matriz A da classe Simplex.
+         *
+         */
+
+        void montaTableauDenso();
+
+        std::vector<double> calculaNormasColunas() override;
+
+        bool calculaIteracaoSimplex(int iteracao) override;
+
+        bool realizaPrimeiraFase() override;
+
+        void printMatrizA() override;
+
+        /**
+         * @brief Perturba o vetor B original e recalcula os valores básicos pela fatoração
+         *
+         */
+
+        void aplicaPerturbacao() override;
+
+        /**
+         * @brief Restaura o vetor B original e recalcula os valores básicos. A viabilidade, se perdida, é restaurada após o cálculo do tableau final.
+         *
+         */
+
+        void removePerturbacao() override;
+
+    public:
+        /**
+         * @brief Construtor da classe. Os parâmetros são os mesmos da classe Simplex.
+         *
+         * @param frequenciaRefatoracao Número de trocas de base entre duas refatorações
+         */
+
+        SimplexRevisado(Matriz coeficientes, std::vector<double> b, std::vector<double> c, bool tipoProblema, bool eDuasFases,
+                        int numVarArtificiais, int numVars, int frequenciaRefatoracao);
+
+        /**
+         * @brief Construtor a partir da matriz de coeficientes esparsa, sem nunca formar a matriz densa.
+         *
+         */
+
+        SimplexRevisado(MatrizEsparsa coeficientes, std::vector<double> b, std::vector<double> c, bool tipoProblema, bool eDuasFases,
+                        int numVarArtificiais, int numVars, int frequenciaRefatoracao);
+
+        /**
+         * @brief Função que inicia o método Simplex revisado.
+         *
+         */
+
+        void aplicaSimplex(std::vector<int> ondeAdicionar) override;
+
+        /**
+         * @brief Monta o tableau denso, caso ele tenha sido omitido por ser grande demais.
+         *
+         */
+
+        void garanteTableauFinal() override;
+};
+
+#endif
@@ -0,0 +1,169 @@
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <algorithm>
+#include <cctype>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "afinidade.hpp"
+
+static const int MAXIMO_NOS_NUMA = 256; // Maior índice de nó NUMA procurado. Os índices podem ter lacunas
+
+/**
+ * @brief Retorna os núcleos em que o processo pode executar. Fora do Linux, supõe os núcleos 0 a hardware_concurrency - 1
+ *
+ */
+
+static std::vector<int> nucleosDisponiveis()
+{
+    std::vector<int> nucleos;
+
+#ifdef __linux__
+    cpu_set_t conjunto;
+
+    CPU_ZERO(&conjunto);
+
+    if (sched_getaffinity(0, sizeof(conjunto), &conjunto) == 0)
+    {
+        for (int c = 0 ; c < CPU_SETSIZE ; c++)
+        {
+            if (CPU_ISSET(c, &conjunto))
+                nucleos.push_back(c);
+        }
+    }
+#endif
+
+    if (nucleos.empty())
+    {
+        int total = std::max(std::thread::hardware_concurrency(), 1u); // hardware_concurrency pode retornar 0 se não souber
+
+        for (int c = 0 ; c < total ; c++)
+            nucleos.push_back(c);
+    }
+
+    return nucleos;
+}
+
+/**
+ * @brief Converte uma lista de núcleos no formato do sysfs, como "0-3,8-11"
+ *
+ */
+
+static std::vector<int> leListaNucleos(const std::string &lista)
+{
+    std::vector<int> nucleos;
+    std::stringstream fluxo(lista);
+    std::string intervalo;
+
+    while (std::getline(fluxo, intervalo, ','))
+    {
+        if (intervalo.empty() || !std::isdigit((unsigned char) intervalo[0]))
+            continue;
+
+        std::size_t hifen = intervalo.find('-');
+        int inicio = std::stoi(intervalo.substr(0, hifen));
+        int fim = hifen == std::string::npos ? inicio : std::stoi(intervalo.substr(hifen + 1));
+
+        for (int c = inicio ; c <= fim ; c++)
+            nucleos.push_back(c);
+    }
+
+    return nucleos;
+}
+
+/**
+ * @brief Lê os núcleos de cada nó NUMA em /sys/devices/system/node, mantendo apenas os disponíveis para o processo.
+ * Sem essa informação, considera um único nó com todos os núcleos disponíveis.
+ *
+ */
+
+static std::vector< std::vector<int> > leNosNuma(const std::vector<int> &disponiveis)
+{
+    std::vector< std::vector<int> > nos;
+
+    for (int no = 0 ; no < MAXIMO_NOS_NUMA ; no++)
+    {
+        std::ifstream arquivo("/sys/devices/system/node/node" + std::to_string(no) + "/cpulist");
+        std::string lista;
+
+        if (!arquivo || !std::getline(arquivo, lista))
+            continue;
+
+        std::vector<int> nucleos;
+
+        for (int c : leListaNucleos(lista))
+        {
+            if (std::find(disponiveis.begin(), disponiveis.end(), c) != disponiveis.end())
+                nucleos.push_back(c);
+        }
+
+        if (!nucleos.empty()) // Nós sem núcleos disponíveis, como os de memória apenas, são ignorados
+            nos.push_back(nucleos);
+    }
+
+    if (nos.empty())
+        nos.push_back(disponiveis);
+
+    return nos;
+}
+
+int contaNucleosDisponiveis()
+{
+    return nucleosDisponiveis().size();
+}
+
+std::vector<AfinidadeThread> planejaAfinidade(int numThreads, ModoAfinidade modo)
+{
+    std::vector<AfinidadeThread> afinidades(numThreads);
+
+    if (modo == ModoAfinidade::NENHUMA)
+        return afinidades;
+
+    std::vector<int> disponiveis = nucleosDisponiveis();
+    std::vector< std::vector<int> > nos = leNosNuma(disponiveis);
+
+    for (int i = 0 ; i < numThreads ; i++)
+    {
+        if (modo == ModoAfinidade::NUMA)
+        {
+            afinidades[i].noNuma = i % nos.size();
+            afinidades[i].nucleos = nos[afinidades[i].noNuma];
+            continue;
+        }
+
+        int nucleo = disponiveis[i % disponiveis.size()]; // Os núcleos são percorridos em ordem, então as primeiras threads ficam no mesmo nó
+
+        afinidades[i].nucleos = {nucleo};
+
+        for (int no = 0 ; no < (int) nos.size() ; no++)
+        {
+            if (std::find(nos[no].begin(), nos[no].end(), nucleo) != nos[no].end())
+                afinidades[i].noNuma = no;
+        }
+    }
+
+    return afinidades;
+}
+
+bool aplicaAfinidade(std::thread &thread, const AfinidadeThread &afinidade)
+{
+    if (afinidade.nucleos.empty())
+        return true;
+
+#ifdef __linux__
+    cpu_set_t conjunto;
+
+    CPU_ZERO(&conjunto);
+
+    for (int c : afinidade.nucleos)
+        CPU_SET(c, &conjunto);
+
+    return pthread_setaffinity_np(thread.native_handle(), sizeof(conjunto), &conjunto) == 0;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,66 @@
+#ifndef AFINIDADE_H
+#define AFINIDADE_H
+
+/**
+ * @file afinidade.hpp
+ * @brief Declaração da distribuição das threads do Branch and Bound entre os núcleos e os nós NUMA da máquina.
+ * A fixação das threads só está disponível no Linux. Nos demais sistemas, as threads são criadas sem fixação.
+ *
+ */
+
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Modos de fixação das threads.
+ *
+ */
+
+enum class ModoAfinidade
+{
+    NENHUMA, // O sistema operacional escolhe onde cada thread executa
+    NUCLEOS, // Cada thread é fixada em um núcleo, em rodízio pelos núcleos disponíveis
+    NUMA // Cada thread é fixada nos núcleos de um nó NUMA, em rodízio pelos nós
+};
+
+/**
+ * @brief Onde uma thread pode executar.
+ *
+ */
+
+typedef struct
+{
+    std::vector<int> nucleos; // Núcleos em que a thread pode executar. Vazio se a thread não é fixada
+    int noNuma = 0; // Nó NUMA da thread, usado para preferir o roubo de trabalho dentro do mesmo nó
+} AfinidadeThread;
+
+/**
+ * @brief Conta os núcleos em que o processo pode executar, respeitando restrições de cpuset como as de contêineres
+ *
+ * @return int O número de núcleos, no mínimo 1
+ */
+
+int contaNucleosDisponiveis();
+
+/**
+ * @brief Distribui as threads conforme o modo. Sem fixação, todas as threads ficam no nó NUMA 0.
+ *
+ * @param numThreads O número de threads
+ * @param modo O modo de fixação
+ * @return std::vector<AfinidadeThread> A afinidade de cada thread
+ */
+
+std::vector<AfinidadeThread> planejaAfinidade(int numThreads, ModoAfinidade modo);
+
+/**
+ * @brief Fixa uma thread já criada nos núcleos da sua afinidade
+ *
+ * @param thread A thread
+ * @param afinidade A afinidade planejada para ela
+ * @return true Se a thread foi fixada ou se não há núcleos a fixar
+ * @return false Se o sistema recusou a fixação ou não a oferece
+ */
+
+bool aplicaAfinidade(std::thread &thread, const AfinidadeThread &afinidade);
+
+#endif
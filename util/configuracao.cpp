@@ -0,0 +1,293 @@
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <cmath>
+
+#include "configuracao.hpp"
+
+/**
+ * @brief Imprime as opções aceitas pelo programa
+ *
+ * @param programa O nome do executável
+ */
+
+static void imprimeUso(const char *programa)
+{
+    std::cout << "Uso: " << programa << " [opções] < entrada\n\n"
+              << "Opções:\n"
+              << "  --metodo tableau|revisado   Método utilizado no problema original (padrão: tableau)\n"
+              << "  --refatoracao N             Trocas de base entre refatorações da LU no Simplex revisado (padrão: 50)\n"
+              << "  --entrada densa|esparsa     Formato da matriz de coeficientes na entrada (padrão: densa)\n"
+              << "  --precificacao REGRA        dantzig, devex, steepest-edge ou parcial (padrão: dantzig)\n"
+              << "  --razao harris|tradicional  Regra do teste da razão (padrão: harris)\n"
+              << "  --bland N                   Iterações sem progresso até a aplicação da regra de Bland (padrão: 50)\n"
+              << "  --perturbacao               Perturba o vetor B durante a segunda fase, removendo a perturbação ao final\n"
+              << "  --limites                   Lê os limites superiores das variáveis após a função objetivo (apenas no tableau)\n"
+              << "  --presolve                  Reduz o problema antes da resolução e leva a solução de volta ao problema original\n"
+              << "  --escalonamento MODO        nenhum, geometrico ou equilibrio (padrão: nenhum)\n"
+              << "  --selecao REGRA             largura, melhor-limite, melhor-estimativa, profundidade ou mergulho (padrão: melhor-limite)\n"
+              << "  --ramificacao REGRA         primeira, mais-fracionaria, menos-fracionaria, pseudocusto, forte ou confiabilidade (padrão: confiabilidade)\n"
+              << "  --threads N                 Threads do Branch and Bound (padrão: uma por núcleo disponível)\n"
+              << "  --afinidade MODO            nenhuma, nucleos ou numa: fixação das threads do Branch and Bound (padrão: nenhuma)\n"
+              << "  --cortes N                  Rodadas de cortes na raiz do Branch and Bound, 0 desativa (padrão: 5)\n"
+              << "  --cortes-nos N              Separa cortes de cobertura e de clique nos nós até a profundidade N (padrão: 0, apenas na raiz)\n"
+              << "  --heuristicas N             Mergulho heurístico a cada N nós do Branch and Bound, 0 desativa as heurísticas (padrão: 10)\n"
+              << "  --limite-nos N              Interrompe o Branch and Bound após N nós resolvidos, 0 não limita (padrão: 0)\n"
+              << "  --limite-tempo S            Interrompe o Branch and Bound após S segundos, 0 não limita (padrão: 0)\n"
+              << "  --gap-absoluto G            Encerra quando o melhor limite supera a incumbente em no máximo G, 0 desativa (padrão: 0)\n"
+              << "  --gap-relativo G            Encerra quando a diferença relativa ao valor da incumbente é no máximo G, 0 desativa (padrão: 0)\n"
+              << "  --limite-solucoes N         Interrompe o Branch and Bound após N melhoras da solução inteira, 0 não limita (padrão: 0)\n"
+              << "  --progresso S               Intervalo em segundos entre as linhas de progresso do Branch and Bound, 0 desativa (padrão: 5)\n"
+              << "  --log-arvore ARQUIVO        Mantém em ARQUIVO o registro binário dos nós do Branch and Bound (padrão: arquivo temporário)\n"
+              << "  --ajuda                     Exibe esta mensagem\n";
+}
+
+/**
+ * @brief Encerra o programa após uma opção inválida
+ *
+ * @param programa O nome do executável
+ * @param mensagem A descrição do erro
+ */
+
+static void encerraComErro(const char *programa, std::string mensagem)
+{
+    std::cout << mensagem << "\n\n";
+    imprimeUso(programa);
+    exit(1);
+}
+
+/**
+ * @brief Converte o valor de uma opção numérica inteira, que deve ser positiva ou, com minimo 0, não negativa
+ *
+ */
+
+static int leInteiroPositivo(const char *programa, std::string opcao, std::string valor, int minimo = 1)
+{
+    try
+    {
+        std::size_t lidos;
+        int numero = std::stoi(valor, &lidos);
+
+        if (lidos == valor.size() && numero >= minimo)
+            return numero;
+    }
+    catch (const std::exception &)
+    {
+
+    }
+
+    encerraComErro(programa, "Valor inválido para " + opcao + ": " + valor);
+    return 0;
+}
+
+/**
+ * @brief Converte o valor de uma opção numérica real, que deve ser finita e não negativa
+ *
+ */
+
+static double leRealNaoNegativo(const char *programa, std::string opcao, std::string valor)
+{
+    try
+    {
+        std::size_t lidos;
+        double numero = std::stod(valor, &lidos);
+
+        if (lidos == valor.size() && std::isfinite(numero) && numero >= 0)
+            return numero;
+    }
+    catch (const std::exception &)
+    {
+
+    }
+
+    encerraComErro(programa, "Valor inválido para " + opcao + ": " + valor);
+    return 0;
+}
+
+Configuracao leConfiguracao(int argc, char **argv)
+{
+    Configuracao configuracao;
+
+    for (int i = 1 ; i < argc ; i++)
+    {
+        std::string opcao = argv[i];
+
+        if (opcao == "--ajuda")
+        {
+            imprimeUso(argv[0]);
+            exit(0);
+        }
+
+        if (opcao == "--limites")
+        {
+            configuracao.leLimites = true;
+            continue;
+        }
+
+        if (opcao == "--perturbacao")
+        {
+            configuracao.perturbacao = true;
+            continue;
+        }
+
+        if (opcao == "--presolve")
+        {
+            configuracao.presolve = true;
+            continue;
+        }
+
+        if (i + 1 >= argc)
+            encerraComErro(argv[0], "Opção desconhecida ou sem valor: " + opcao);
+
+        std::string valor = argv[++i];
+
+        if (opcao == "--metodo")
+        {
+            if (valor == "tableau")
+                configuracao.metodo = MetodoSimplex::TABLEAU;
+            else if (valor == "revisado")
+                configuracao.metodo = MetodoSimplex::REVISADO;
+            else
+                encerraComErro(argv[0], "Método desconhecido: " + valor);
+        }
+
+        else if (opcao == "--refatoracao")
+            configuracao.frequenciaRefatoracao = leInteiroPositivo(argv[0], opcao, valor);
+
+        else if (opcao == "--entrada")
+        {
+            if (valor == "densa")
+                configuracao.entrada = FormatoEntrada::DENSA;
+            else if (valor == "esparsa")
+                configuracao.entrada = FormatoEntrada::ESPARSA;
+            else
+                encerraComErro(argv[0], "Formato de entrada desconhecido: " + valor);
+        }
+
+        else if (opcao == "--precificacao")
+        {
+            if (valor == "dantzig")
+                configuracao.precificacao = RegraPrecificacao::DANTZIG;
+            else if (valor == "devex")
+                configuracao.precificacao = RegraPrecificacao::DEVEX;
+            else if (valor == "steepest-edge")
+                configuracao.precificacao = RegraPrecificacao::STEEPEST_EDGE;
+            else if (valor == "parcial")
+                configuracao.precificacao = RegraPrecificacao::PARCIAL;
+            else
+                encerraComErro(argv[0], "Regra de precificação desconhecida: " + valor);
+        }
+
+        else if (opcao == "--razao")
+        {
+            if (valor == "harris")
+                configuracao.razao = RegraRazao::HARRIS;
+            else if (valor == "tradicional")
+                configuracao.razao = RegraRazao::TRADICIONAL;
+            else
+                encerraComErro(argv[0], "Regra do teste da razão desconhecida: " + valor);
+        }
+
+        else if (opcao == "--escalonamento")
+        {
+            if (valor == "nenhum")
+                configuracao.escalonamento = MetodoEscalonamento::NENHUM;
+            else if (valor == "geometrico")
+                configuracao.escalonamento = MetodoEscalonamento::GEOMETRICO;
+            else if (valor == "equilibrio")
+                configuracao.escalonamento = MetodoEscalonamento::EQUILIBRIO;
+            else
+                encerraComErro(argv[0], "Método de escalonamento desconhecido: " + valor);
+        }
+
+        else if (opcao == "--selecao")
+        {
+            if (valor == "largura")
+                configuracao.selecao = RegraSelecaoNo::LARGURA;
+            else if (valor == "melhor-limite")
+                configuracao.selecao = RegraSelecaoNo::MELHOR_LIMITE;
+            else if (valor == "melhor-estimativa")
+                configuracao.selecao = RegraSelecaoNo::MELHOR_ESTIMATIVA;
+            else if (valor == "profundidade")
+                configuracao.selecao = RegraSelecaoNo::PROFUNDIDADE;
+            else if (valor == "mergulho")
+                configuracao.selecao = RegraSelecaoNo::MERGULHO;
+            else
+                encerraComErro(argv[0], "Regra de seleção de nós desconhecida: " + valor);
+        }
+
+        else if (opcao == "--ramificacao")
+        {
+            if (valor == "primeira")
+                configuracao.ramificacao = RegraRamificacao::PRIMEIRA;
+            else if (valor == "mais-fracionaria")
+                configuracao.ramificacao = RegraRamificacao::MAIS_FRACIONARIA;
+            else if (valor == "menos-fracionaria")
+                configuracao.ramificacao = RegraRamificacao::MENOS_FRACIONARIA;
+            else if (valor == "pseudocusto")
+                configuracao.ramificacao = RegraRamificacao::PSEUDOCUSTO;
+            else if (valor == "forte")
+                configuracao.ramificacao = RegraRamificacao::FORTE;
+            else if (valor == "confiabilidade")
+                configuracao.ramificacao = RegraRamificacao::CONFIABILIDADE;
+            else
+                encerraComErro(argv[0], "Regra de ramificação desconhecida: " + valor);
+        }
+
+        else if (opcao == "--bland")
+            configuracao.limiteSemProgresso = leInteiroPositivo(argv[0], opcao, valor);
+
+        else if (opcao == "--threads")
+            configuracao.numThreads = leInteiroPositivo(argv[0], opcao, valor);
+
+        else if (opcao == "--afinidade")
+        {
+            if (valor == "nenhuma")
+                configuracao.afinidade = ModoAfinidade::NENHUMA;
+            else if (valor == "nucleos")
+                configuracao.afinidade = ModoAfinidade::NUCLEOS;
+            else if (valor == "numa")
+                configuracao.afinidade = ModoAfinidade::NUMA;
+            else
+                encerraComErro(argv[0], "Modo de afinidade desconhecido: " + valor);
+        }
+
+        else if (opcao == "--cortes")
+            configuracao.rodadasCortes = leInteiroPositivo(argv[0], opcao, valor, 0);
+
+        else if (opcao == "--cortes-nos")
+            configuracao.profundidadeCortes = leInteiroPositivo(argv[0], opcao, valor, 0);
+
+        else if (opcao == "--heuristicas")
+            configuracao.frequenciaHeuristicas = leInteiroPositivo(argv[0], opcao, valor, 0);
+
+        else if (opcao == "--limite-nos")
+            configuracao.limiteNos = leInteiroPositivo(argv[0], opcao, valor, 0);
+
+        else if (opcao == "--limite-tempo")
+            configuracao.limiteTempo = leRealNaoNegativo(argv[0], opcao, valor);
+
+        else if (opcao == "--gap-absoluto")
+            configuracao.gapAbsoluto = leRealNaoNegativo(argv[0], opcao, valor);
+
+        else if (opcao == "--gap-relativo")
+            configuracao.gapRelativo = leRealNaoNegativo(argv[0], opcao, valor);
+
+        else if (opcao == "--limite-solucoes")
+            configuracao.limiteSolucoes = leInteiroPositivo(argv[0], opcao, valor, 0);
+
+        else if (opcao == "--progresso")
+            configuracao.intervaloProgresso = leRealNaoNegativo(argv[0], opcao, valor);
+
+        else if (opcao == "--log-arvore")
+            configuracao.logArvore = valor;
+
+        else
+            encerraComErro(argv[0], "Opção desconhecida: " + opcao);
+    }
+
+    if (configuracao.leLimites && configuracao.metodo == MetodoSimplex::REVISADO)
+        encerraComErro(argv[0], "A opção --limites não está disponível no Simplex revisado.");
+
+    return configuracao;
+}
@@ -0,0 +1,121 @@
+#ifndef CONFIGURACAO_H
+#define CONFIGURACAO_H
+
+/**
+ * @file configuracao.hpp
+ * @brief Declaração das opções de execução do programa, fornecidas pela linha de comando.
+ *
+ */
+
+#include <string>
+
+#include "precificacao.hpp"
+#include "escalonamento.hpp"
+#include "afinidade.hpp"
+
+/**
+ * @brief Métodos disponíveis para a resolução do problema de programação linear original.
+ *
+ */
+
+enum class MetodoSimplex
+{
+    TABLEAU, // Simplex de duas fases sobre o tableau denso completo
+    REVISADO // Simplex revisado com fatoração LU da base
+};
+
+/**
+ * @brief Regras disponíveis para o teste da razão.
+ *
+ */
+
+enum class RegraRazao
+{
+    TRADICIONAL, // Menor razão exata, com empates decididos pela última linha
+    HARRIS // Teste de Harris em duas passagens: razões relaxadas pela tolerância e, entre elas, o maior pivô
+};
+
+/**
+ * @brief Regras de escolha do próximo nó do Branch and Bound a ser resolvido.
+ *
+ */
+
+enum class RegraSelecaoNo
+{
+    LARGURA, // Busca em largura: o nó mais antigo
+    MELHOR_LIMITE, // O nó cujo pai tem o melhor valor da relaxação linear
+    MELHOR_ESTIMATIVA, // O nó com a melhor estimativa do valor inteiro, a partir do limite do pai e das inviabilidades inteiras dele
+    PROFUNDIDADE, // Busca em profundidade, com o nó de melhor limite escolhido periodicamente
+    MERGULHO // Mergulho: um filho é resolvido imediatamente pela mesma thread e o irmão é empilhado para o retrocesso
+};
+
+/**
+ * @brief Regras de escolha da variável fracionária em que um nó do Branch and Bound é dividido.
+ *
+ */
+
+enum class RegraRamificacao
+{
+    PRIMEIRA, // A primeira coordenada fracionária
+    MAIS_FRACIONARIA, // A coordenada de parte fracionária mais próxima de 0,5
+    MENOS_FRACIONARIA, // A coordenada mais próxima de um inteiro
+    PSEUDOCUSTO, // O maior produto das pioras estimadas pelos pseudo-custos, a piora média por unidade observada em cada variável
+    FORTE, // O maior produto das pioras obtidas resolvendo os dois filhos das candidatas mais fracionárias
+    CONFIABILIDADE // Pseudo-custos, com a ramificação forte nas variáveis que ainda têm poucas observações
+};
+
+/**
+ * @brief Formatos aceitos para a leitura da matriz de coeficientes.
+ *
+ */
+
+enum class FormatoEntrada
+{
+    DENSA, // Todos os coeficientes de cada restrição
+    ESPARSA // Apenas os coeficientes não nulos, como triplas (restrição, coluna, valor)
+};
+
+/**
+ * @brief Contém as opções de execução. Os valores iniciais são os utilizados quando a opção não é fornecida.
+ *
+ */
+
+typedef struct
+{
+    MetodoSimplex metodo = MetodoSimplex::TABLEAU; // Método utilizado na resolução do problema original
+    int frequenciaRefatoracao = 50; // Número de trocas de base entre duas refatorações da base no Simplex revisado
+    FormatoEntrada entrada = FormatoEntrada::DENSA; // Formato da matriz de coeficientes na entrada
+    RegraPrecificacao precificacao = RegraPrecificacao::DANTZIG; // Regra de escolha da variável que entra na base
+    RegraRazao razao = RegraRazao::HARRIS; // Regra do teste da razão
+    int limiteSemProgresso = 50; // Iterações sem aumento do objetivo até a aplicação da regra de Bland
+    bool perturbacao = false; // Indica se o vetor B é perturbado durante a segunda fase
+    bool leLimites = false; // Indica se a entrada contém os limites superiores das variáveis após a função objetivo
+    bool presolve = false; // Indica se o problema é reduzido pelo presolve antes da resolução
+    MetodoEscalonamento escalonamento = MetodoEscalonamento::NENHUM; // Escalonamento da matriz de coeficientes antes da resolução
+    RegraSelecaoNo selecao = RegraSelecaoNo::MELHOR_LIMITE; // Escolha do próximo nó do Branch and Bound
+    RegraRamificacao ramificacao = RegraRamificacao::CONFIABILIDADE; // Escolha da variável ramificada em cada nó do Branch and Bound
+    int numThreads = 0; // Número de threads do Branch and Bound. 0 usa um thread por núcleo disponível
+    ModoAfinidade afinidade = ModoAfinidade::NENHUMA; // Fixação das threads do Branch and Bound em núcleos ou nós NUMA
+    int rodadasCortes = 5; // Rodadas de cortes na raiz do Branch and Bound. 0 desativa os cortes na raiz
+    int profundidadeCortes = 0; // Profundidade máxima dos nós em que os cortes de cobertura e de clique são separados. 0 separa apenas na raiz
+    int frequenciaHeuristicas = 10; // Intervalo, em nós, entre dois mergulhos heurísticos no Branch and Bound. 0 desativa as heurísticas primais
+    int limiteNos = 0; // Nós resolvidos pelo Branch and Bound até a interrupção. 0 não limita
+    double limiteTempo = 0; // Segundos de Branch and Bound, desde a raiz, até a interrupção. 0 não limita
+    double gapAbsoluto = 0; // Diferença entre o melhor limite e a incumbente que encerra o Branch and Bound. 0 desativa
+    double gapRelativo = 0; // Diferença relativa ao valor da incumbente que encerra o Branch and Bound. 0 desativa
+    int limiteSolucoes = 0; // Melhoras da incumbente até a interrupção. 0 não limita
+    double intervaloProgresso = 5; // Segundos entre duas linhas de progresso do Branch and Bound. 0 desativa
+    std::string logArvore; // Arquivo binário do registro dos nós do Branch and Bound. Vazio usa um arquivo temporário
+} Configuracao;
+
+/**
+ * @brief Lê as opções da linha de comando. Em caso de opção inválida, imprime o uso do programa e encerra.
+ *
+ * @param argc Número de argumentos
+ * @param argv Os argumentos
+ * @return Configuracao As opções lidas
+ */
+
+Configuracao leConfiguracao(int argc, char **argv);
+
+#endif
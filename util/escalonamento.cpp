@@ -0,0 +1,203 @@
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "escalonamento.hpp"
+
+static const int MAXIMO_PASSADAS_GEOMETRICAS = 20; // Número máximo de passadas da média geométrica
+static const double MELHORA_MINIMA_RAZAO = 0.9; // As passadas param quando a razão entre coeficientes cai menos de 10%
+
+/**
+ * @brief Indica, para cada coluna, se ela é uma folga: está após as variáveis da forma canônica e tem um único coeficiente 1 ou -1
+ *
+ */
+
+static std::vector<bool> identificaFolgas(const MatrizEsparsa &a, int numVars)
+{
+    std::vector<bool> eFolga(a.getColunas(), false);
+
+    for (int j = numVars ; j < a.getColunas() ; j++)
+        eFolga[j] = a.fimColuna(j) - a.inicioColuna(j) == 1 && std::fabs(a.valorElemento(a.inicioColuna(j))) == 1;
+
+    return eFolga;
+}
+
+/**
+ * @brief Calcula a razão entre o maior e o menor coeficiente em módulo de r_i a_ij s_j, sem as folgas
+ *
+ */
+
+static double calculaRazao(const MatrizEsparsa &a, const std::vector<bool> &eFolga, const std::vector<double> &r, const std::vector<double> &s)
+{
+    double menor = std::numeric_limits<double>::infinity();
+    double maior = 0;
+
+    for (int j = 0 ; j < a.getColunas() ; j++)
+    {
+        if (eFolga[j])
+            continue;
+
+        for (int p = a.inicioColuna(j) ; p < a.fimColuna(j) ; p++)
+        {
+            double valor = std::fabs(a.valorElemento(p)) * r[a.linhaElemento(p)] * s[j];
+
+            menor = std::min(menor, valor);
+            maior = std::max(maior, valor);
+        }
+    }
+
+    return maior > 0 ? maior / menor : 1;
+}
+
+/**
+ * @brief Divide o fator de cada linha pela média geométrica do menor e do maior coeficiente escalonado dela, ou pelo maior, no equilíbrio
+ *
+ */
+
+static void escalonaLinhas(const MatrizEsparsa &a, const std::vector<bool> &eFolga, std::vector<double> &r, const std::vector<double> &s, bool equilibrio)
+{
+    std::vector<double> menor(a.getLinhas(), std::numeric_limits<double>::infinity());
+    std::vector<double> maior(a.getLinhas(), 0);
+
+    for (int j = 0 ; j < a.getColunas() ; j++)
+    {
+        if (eFolga[j])
+            continue;
+
+        for (int p = a.inicioColuna(j) ; p < a.fimColuna(j) ; p++)
+        {
+            int i = a.linhaElemento(p);
+            double valor = std::fabs(a.valorElemento(p)) * r[i] * s[j];
+
+            menor[i] = std::min(menor[i], valor);
+            maior[i] = std::max(maior[i], valor);
+        }
+    }
+
+    for (int i = 0 ; i < a.getLinhas() ; i++)
+    {
+        if (maior[i] > 0) // Restrições sem coeficientes fora das folgas mantêm o fator
+            r[i] /= equilibrio ? maior[i] : std::sqrt(menor[i] * maior[i]);
+    }
+}
+
+/**
+ * @brief Análogo a escalonaLinhas, para as colunas que não são folgas
+ *
+ */
+
+static void escalonaColunas(const MatrizEsparsa &a, const std::vector<bool> &eFolga, const std::vector<double> &r, std::vector<double> &s, bool equilibrio)
+{
+    for (int j = 0 ; j < a.getColunas() ; j++)
+    {
+        if (eFolga[j] || a.fimColuna(j) == a.inicioColuna(j))
+            continue;
+
+        double menor = std::numeric_limits<double>::infinity();
+        double maior = 0;
+
+        for (int p = a.inicioColuna(j) ; p < a.fimColuna(j) ; p++)
+        {
+            double valor = std::fabs(a.valorElemento(p)) * r[a.linhaElemento(p)] * s[j];
+
+            menor = std::min(menor, valor);
+            maior = std::max(maior, valor);
+        }
+
+        s[j] /= equilibrio ? maior : std::sqrt(menor * maior);
+    }
+}
+
+/**
+ * @brief Arredonda o fator para a potência de 2 mais próxima, para que as multiplicações pelo fator sejam exatas
+ *
+ */
+
+static double potenciaDeDois(double fator)
+{
+    return std::exp2(std::round(std::log2(fator)));
+}
+
+FatoresEscala realizaEscalonamento(MatrizEsparsa &a, std::vector<double> &b, std::vector<double> &c, int numVars, std::vector<double> &limites,
+                                    MetodoEscalonamento metodo)
+{
+    FatoresEscala fatores;
+    std::vector<bool> eFolga = identificaFolgas(a, numVars);
+
+    fatores.linhas.assign(a.getLinhas(), 1);
+    fatores.colunas.assign(a.getColunas(), 1);
+    fatores.razaoOriginal = fatores.razaoFinal = calculaRazao(a, eFolga, fatores.linhas, fatores.colunas);
+
+    if (metodo == MetodoEscalonamento::NENHUM)
+        return fatores;
+
+    std::vector<double> &r = fatores.linhas;
+    std::vector<double> &s = fatores.colunas;
+
+    if (metodo == MetodoEscalonamento::GEOMETRICO)
+    {
+        double razao = fatores.razaoOriginal;
+
+        for (int passada = 0 ; passada < MAXIMO_PASSADAS_GEOMETRICAS ; passada++)
+        {
+            escalonaLinhas(a, eFolga, r, s, false);
+            escalonaColunas(a, eFolga, r, s, false);
+
+            double novaRazao = calculaRazao(a, eFolga, r, s);
+
+            if (novaRazao > MELHORA_MINIMA_RAZAO * razao)
+                break;
+
+            razao = novaRazao;
+        }
+    }
+
+    escalonaLinhas(a, eFolga, r, s, true);
+    escalonaColunas(a, eFolga, r, s, true);
+
+    for (double &fator : r)
+        fator = potenciaDeDois(fator);
+
+    for (int j = 0 ; j < a.getColunas() ; j++)
+    {
+        if (eFolga[j]) // A folga acompanha a sua restrição e continua com coeficiente 1 ou -1
+            s[j] = 1 / r[a.linhaElemento(a.inicioColuna(j))];
+        else
+            s[j] = potenciaDeDois(s[j]);
+    }
+
+    fatores.aplicado = std::any_of(r.begin(), r.end(), [](double fator){ return fator != 1; })
+                        || std::any_of(s.begin(), s.end(), [](double fator){ return fator != 1; });
+
+    if (!fatores.aplicado)
+        return fatores;
+
+    fatores.razaoFinal = calculaRazao(a, eFolga, r, s);
+
+    std::vector<ElementoEsparso> elementos;
+
+    elementos.reserve(a.getNaoNulos());
+
+    for (int j = 0 ; j < a.getColunas() ; j++)
+    {
+        for (int p = a.inicioColuna(j) ; p < a.fimColuna(j) ; p++)
+        {
+            int i = a.linhaElemento(p);
+
+            elementos.push_back({i, j, r[i] * a.valorElemento(p) * s[j]});
+        }
+    }
+
+    a = MatrizEsparsa(a.getLinhas(), a.getColunas(), elementos);
+
+    for (int i = 0 ; i < (int) b.size() ; i++)
+        b[i] *= r[i];
+
+    for (int j = 0 ; j < (int) c.size() ; j++)
+        c[j] *= s[j];
+
+    for (int j = 0 ; j < numVars && j < (int) limites.size() ; j++)
+        limites[j] /= s[j]; // O infinito continua infinito
+
+    return fatores;
+}
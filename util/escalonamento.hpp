@@ -0,0 +1,58 @@
+#ifndef ESCALONAMENTO_H
+#define ESCALONAMENTO_H
+
+/**
+ * @file escalonamento.hpp
+ * @brief Declaração do escalonamento da matriz de coeficientes, aplicado antes da criação do Simplex para que os coeficientes
+ * tenham magnitudes próximas de 1 e as tolerâncias absolutas do Simplex e do Branch and Bound façam sentido.
+ *
+ */
+
+#include <vector>
+
+#include "matriz_esparsa.hpp"
+
+/**
+ * @brief Métodos de escalonamento disponíveis.
+ *
+ */
+
+enum class MetodoEscalonamento
+{
+    NENHUM, // O problema é resolvido com os coeficientes fornecidos
+    GEOMETRICO, // Passadas de média geométrica por linhas e colunas, seguidas do equilíbrio
+    EQUILIBRIO // Apenas o equilíbrio: o maior coeficiente de cada linha e depois de cada coluna passa a ter módulo 1
+};
+
+/**
+ * @brief Fatores do escalonamento A' = R A S. Os fatores são potências de 2, então o escalonamento não introduz erro de arredondamento.
+ * A variável x_j do problema original vale s_j x'_j, e as folgas recebem s_j = 1 / r_i para que continuem com coeficiente 1 ou -1.
+ *
+ */
+
+typedef struct
+{
+    bool aplicado = false; // Indica se algum fator é diferente de 1
+    std::vector<double> linhas; // Fator r_i de cada restrição
+    std::vector<double> colunas; // Fator s_j de cada coluna, incluindo as folgas
+    double razaoOriginal = 1; // Razão entre o maior e o menor coeficiente não nulo em módulo antes do escalonamento
+    double razaoFinal = 1; // A mesma razão após o escalonamento
+} FatoresEscala;
+
+/**
+ * @brief Escalona as restrições e as variáveis do problema. As colunas de folga, com um único coeficiente 1 ou -1, não participam
+ * do cálculo dos fatores. A função objetivo não é escalonada por linha, então o valor ótimo não se altera.
+ *
+ * @param a A matriz de coeficientes na forma padrão, substituída pela escalonada
+ * @param b O vetor de soluções das restrições, multiplicado por R
+ * @param c O vetor de coeficientes da função objetivo, multiplicado por S
+ * @param numVars O número de variáveis na forma canônica
+ * @param limites O limite superior de cada variável da forma canônica, dividido por S
+ * @param metodo O método de escalonamento
+ * @return FatoresEscala Os fatores aplicados, para o desescalonamento da solução
+ */
+
+FatoresEscala realizaEscalonamento(MatrizEsparsa &a, std::vector<double> &b, std::vector<double> &c, int numVars, std::vector<double> &limites,
+                                    MetodoEscalonamento metodo);
+
+#endif
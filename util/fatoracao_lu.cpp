@@ -0,0 +1,155 @@
+#include <cmath>
+#include <algorithm>
+#include <utility>
+
+#include "fatoracao_lu.hpp"
+#include "vetorizacao.hpp"
+
+static const double TOLERANCIA_PIVO_LU = 1e-11; // Abaixo desse valor, o pivô da eliminação é considerado nulo
+
+FatoracaoLU::FatoracaoLU() : dimensao(0)
+{
+
+}
+
+bool FatoracaoLU::fatora(const MatrizEsparsa &a, const std::vector<int> &colunasBase)
+{
+    dimensao = colunasBase.size();
+    lu = Matriz(dimensao, dimensao);
+    etas.clear();
+    permutacao.resize(dimensao);
+
+    for (int i = 0 ; i < dimensao ; i++)
+        permutacao[i] = i;
+
+    for (int k = 0 ; k < dimensao ; k++) // Espalha os elementos não nulos das colunas básicas na matriz densa
+    {
+        for (int p = a.inicioColuna(colunasBase[k]) ; p < a.fimColuna(colunasBase[k]) ; p++)
+            lu[a.linhaElemento(p)][k] = a.valorElemento(p);
+    }
+
+    for (int k = 0 ; k < dimensao ; k++)
+    {
+        int linhaPivo = k;
+
+        for (int i = k + 1 ; i < dimensao ; i++) // Pivoteamento parcial: o maior elemento da coluna em módulo
+        {
+            if (std::fabs(lu[i][k]) > std::fabs(lu[linhaPivo][k]))
+                linhaPivo = i;
+        }
+
+        if (std::fabs(lu[linhaPivo][k]) < TOLERANCIA_PIVO_LU)
+            return false;
+
+        if (linhaPivo != k)
+        {
+            std::swap_ranges(lu[k], lu[k] + dimensao, lu[linhaPivo]);
+            std::swap(permutacao[k], permutacao[linhaPivo]);
+        }
+
+        for (int i = k + 1 ; i < dimensao ; i++)
+        {
+            double multiplicador = lu[i][k] / lu[k][k];
+
+            lu[i][k] = multiplicador; // Guarda o elemento de L no lugar do elemento eliminado
+
+            if (multiplicador != 0)
+                subtraiMultiplo(lu[i] + k + 1, lu[k] + k + 1, multiplicador, dimensao - k - 1);
+        }
+    }
+
+    return true;
+}
+
+void FatoracaoLU::ftran(std::vector<double> &v) const
+{
+    std::vector<double> y(dimensao);
+
+    for (int i = 0 ; i < dimensao ; i++) // Aplica a permutação e resolve L y = P v
+    {
+        double soma = v[permutacao[i]];
+
+        for (int k = 0 ; k < i ; k++)
+            soma -= lu[i][k] * y[k];
+
+        y[i] = soma;
+    }
+
+    for (int i = dimensao - 1 ; i >= 0 ; i--) // Resolve U x = y
+    {
+        double soma = y[i];
+
+        for (int k = i + 1 ; k < dimensao ; k++)
+            soma -= lu[i][k] * y[k];
+
+        y[i] = soma / lu[i][i];
+    }
+
+    for (const Eta &e : etas) // Aplica as inversas das etas, da mais antiga para a mais recente
+    {
+        double valorPivo = y[e.linha] / e.pivo;
+
+        y[e.linha] = valorPivo;
+
+        if (valorPivo == 0)
+            continue;
+
+        for (int k = 0 ; k < (int) e.indices.size() ; k++)
+            y[e.indices[k]] -= e.valores[k] * valorPivo;
+    }
+
+    v.swap(y);
+}
+
+void FatoracaoLU::btran(std::vector<double> &v) const
+{
+    for (auto e = etas.rbegin() ; e != etas.rend() ; e++) // Aplica as transpostas das inversas das etas, da mais recente para a mais antiga
+    {
+        double soma = v[e->linha];
+
+        for (int k = 0 ; k < (int) e->indices.size() ; k++)
+            soma -= e->valores[k] * v[e->indices[k]];
+
+        v[e->linha] = soma / e->pivo;
+    }
+
+    for (int k = 0 ; k < dimensao ; k++) // Resolve U^T w = v, percorrendo U por linhas
+    {
+        v[k] = v[k] / lu[k][k];
+
+        if (v[k] != 0)
+            subtraiMultiplo(v.data() + k + 1, lu[k] + k + 1, v[k], dimensao - k - 1);
+    }
+
+    for (int k = dimensao - 1 ; k > 0 ; k--) // Resolve L^T z = w, percorrendo L por linhas
+    {
+        if (v[k] != 0)
+            subtraiMultiplo(v.data(), lu[k], v[k], k);
+    }
+
+    std::vector<double> y(dimensao);
+
+    for (int i = 0 ; i < dimensao ; i++) // Desfaz a permutação
+        y[permutacao[i]] = v[i];
+
+    v.swap(y);
+}
+
+void FatoracaoLU::atualiza(int linha, const std::vector<double> &colunaTransformada)
+{
+    Eta e;
+
+    e.linha = linha;
+    e.pivo = colunaTransformada[linha];
+
+    for (int i = 0 ; i < dimensao ; i++)
+    {
+        if (i != linha && colunaTransformada[i] != 0)
+        {
+            e.indices.push_back(i);
+            e.valores.push_back(colunaTransformada[i]);
+        }
+    }
+
+    etas.push_back(std::move(e));
+}
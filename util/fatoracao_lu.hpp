@@ -0,0 +1,93 @@
+#ifndef FATORACAO_LU_H
+#define FATORACAO_LU_H
+
+/**
+ * @file fatoracao_lu.hpp
+ * @brief Declaração da fatoração LU da matriz básica utilizada pelo Simplex revisado.
+ *
+ */
+
+#include <vector>
+
+#include "matriz.hpp"
+#include "matriz_esparsa.hpp"
+
+/**
+ * @brief Fatoração LU com pivoteamento parcial da matriz básica, atualizada na forma produto.
+ *
+ * A refatoração calcula PB_0 = LU. A cada troca de base, em vez de refatorar, guardamos uma matriz eta E_k,
+ * que é a identidade com a coluna da linha pivô substituída pela coluna transformada B_{k-1}^{-1} a_q.
+ * Assim, B_k = B_0 E_1 ... E_k, e os sistemas com B_k são resolvidos pela LU seguida das etas.
+ * Como as etas acumulam erro numérico e tornam as resoluções mais caras, a matriz deve ser refatorada periodicamente.
+ */
+
+class FatoracaoLU
+{
+    private:
+        /**
+         * @brief Matriz eta guardada de forma esparsa: apenas os elementos não nulos da coluna, exceto o pivô.
+         *
+         */
+
+        typedef struct
+        {
+            int linha; // Linha do pivô
+            double pivo; // Elemento da coluna na linha do pivô
+            std::vector<int> indices; // Linhas dos demais elementos não nulos
+            std::vector<double> valores; // Valores dos demais elementos não nulos
+        } Eta;
+
+        int dimensao; // Número de linhas da matriz básica
+        Matriz lu; // L abaixo da diagonal (com diagonal unitária implícita) e U na diagonal e acima dela
+        std::vector<int> permutacao; // A linha i de PB é a linha permutacao[i] de B
+        std::vector<Eta> etas; // Atualizações desde a última refatoração
+
+    public:
+        FatoracaoLU();
+
+        /**
+         * @brief Fatora a matriz formada pelas colunas indicadas da matriz de coeficientes, descartando as etas.
+         *
+         * @param a A matriz de coeficientes original, armazenada por colunas
+         * @param colunasBase O índice da coluna de a que ocupa cada posição da base
+         * @return true Se a matriz básica é não singular
+         * @return false Caso contrário
+         */
+
+        bool fatora(const MatrizEsparsa &a, const std::vector<int> &colunasBase);
+
+        /**
+         * @brief Resolve B x = v, sobrescrevendo v com x.
+         *
+         * @param v O lado direito do sistema
+         */
+
+        void ftran(std::vector<double> &v) const;
+
+        /**
+         * @brief Resolve B^T y = v, sobrescrevendo v com y.
+         *
+         * @param v O lado direito do sistema
+         */
+
+        void btran(std::vector<double> &v) const;
+
+        /**
+         * @brief Registra a troca da variável básica da linha indicada.
+         *
+         * @param linha A linha do pivô
+         * @param colunaTransformada A coluna da variável que entra na base, já multiplicada por B^{-1}
+         */
+
+        void atualiza(int linha, const std::vector<double> &colunaTransformada);
+
+        /**
+         * @brief Retorna o número de atualizações desde a última refatoração
+         *
+         * @return int O número de etas guardadas
+         */
+
+        int getNumAtualizacoes() const { return etas.size(); }
+};
+
+#endif
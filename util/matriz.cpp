@@ -0,0 +1,209 @@
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <algorithm>
+#include <utility>
+
+#include "matriz.hpp"
+
+/**
+ * @brief Arredonda o número de colunas para o próximo múltiplo da granularidade do passo.
+ *
+ * @param colunas O número de colunas
+ * @return int O passo correspondente
+ */
+
+static int calculaPasso(int colunas)
+{
+    int bloco = Matriz::DOUBLES_POR_BLOCO;
+
+    return ((colunas + bloco - 1) / bloco) * bloco;
+}
+
+/**
+ * @brief Aloca um bloco alinhado e zerado para o número de doubles indicado.
+ *
+ * @param tamanho O número de doubles
+ * @return double* O bloco alocado ou nullptr se o tamanho é nulo
+ */
+
+static double* alocaBloco(std::size_t tamanho)
+{
+    if (tamanho == 0)
+        return nullptr;
+
+    void *bloco = std::aligned_alloc(Matriz::ALINHAMENTO, tamanho * sizeof(double)); // O tamanho é múltiplo do alinhamento, pois o passo é.
+
+    if (bloco == nullptr)
+        throw std::bad_alloc();
+
+    std::memset(bloco, 0, tamanho * sizeof(double));
+
+    return static_cast<double*>(bloco);
+}
+
+Matriz::Matriz() : dados(nullptr), numLinhas(0), numColunas(0), passo(0), capacidadeLinhas(0)
+{
+
+}
+
+Matriz::Matriz(int linhas, int colunas, int colunasReserva, int linhasReserva)
+{
+    numLinhas = linhas;
+    numColunas = colunas;
+    passo = calculaPasso(colunas + colunasReserva);
+    capacidadeLinhas = linhas + linhasReserva;
+    dados = alocaBloco((std::size_t) passo * capacidadeLinhas);
+}
+
+Matriz::Matriz(const std::vector<std::vector<double>> &linhas, int colunasReserva)
+    : Matriz(linhas.size(), linhas.empty() ? 0 : linhas[0].size(), colunasReserva)
+{
+    for (int i = 0 ; i < numLinhas ; i++)
+        std::copy(linhas[i].begin(), linhas[i].end(), (*this)[i]);
+}
+
+Matriz::Matriz(const Matriz &outra)
+{
+    numLinhas = outra.numLinhas;
+    numColunas = outra.numColunas;
+    passo = outra.passo;
+    capacidadeLinhas = outra.numLinhas; // A cópia não herda a reserva de linhas, apenas a de colunas, que está no passo.
+    dados = alocaBloco((std::size_t) passo * capacidadeLinhas);
+
+    if (dados != nullptr)
+        std::memcpy(dados, outra.dados, (std::size_t) passo * numLinhas * sizeof(double));
+}
+
+Matriz::Matriz(Matriz &&outra) noexcept
+{
+    dados = outra.dados;
+    numLinhas = outra.numLinhas;
+    numColunas = outra.numColunas;
+    passo = outra.passo;
+    capacidadeLinhas = outra.capacidadeLinhas;
+
+    outra.dados = nullptr;
+    outra.numLinhas = outra.numColunas = outra.passo = outra.capacidadeLinhas = 0;
+}
+
+Matriz& Matriz::operator=(const Matriz &outra)
+{
+    if (this != &outra)
+    {
+        Matriz copia(outra);
+        *this = std::move(copia);
+    }
+
+    return *this;
+}
+
+Matriz& Matriz::operator=(Matriz &&outra) noexcept
+{
+    if (this != &outra)
+    {
+        std::free(dados);
+
+        dados = outra.dados;
+        numLinhas = outra.numLinhas;
+        numColunas = outra.numColunas;
+        passo = outra.passo;
+        capacidadeLinhas = outra.capacidadeLinhas;
+
+        outra.dados = nullptr;
+        outra.numLinhas = outra.numColunas = outra.passo = outra.capacidadeLinhas = 0;
+    }
+
+    return *this;
+}
+
+Matriz::~Matriz()
+{
+    std::free(dados);
+}
+
+void Matriz::realoca(int novoPasso, int novaCapacidadeLinhas)
+{
+    double *novosDados = alocaBloco((std::size_t) novoPasso * novaCapacidadeLinhas);
+
+    for (int i = 0 ; i < numLinhas ; i++)
+        std::memcpy(novosDados + (std::size_t) i * novoPasso, (*this)[i], numColunas * sizeof(double));
+
+    std::free(dados);
+
+    dados = novosDados;
+    passo = novoPasso;
+    capacidadeLinhas = novaCapacidadeLinhas;
+}
+
+void Matriz::adicionaColuna(const std::vector<double> &valores)
+{
+    if (numColunas == passo) // Sem capacidade reserva. Reserva metade das colunas atuais a mais, para amortizar as próximas inserções.
+        realoca(calculaPasso(numColunas + std::max(numColunas / 2, (int) DOUBLES_POR_BLOCO)), capacidadeLinhas);
+
+    if (!valores.empty())
+    {
+        for (int i = 0 ; i < numLinhas ; i++)
+            (*this)[i][numColunas] = valores[i];
+    }
+
+    numColunas++; // Sem valores, a coluna já está zerada, pois o preenchimento é sempre nulo.
+}
+
+void Matriz::adicionaLinha(const std::vector<double> &valores)
+{
+    if (numLinhas == capacidadeLinhas)
+        realoca(passo, capacidadeLinhas + std::max(capacidadeLinhas / 2, 4));
+
+    double *linha = (*this)[numLinhas];
+
+    std::fill(linha, linha + passo, 0);
+    std::copy(valores.begin(), valores.begin() + std::min((int) valores.size(), numColunas), linha);
+
+    numLinhas++;
+}
+
+void Matriz::removeColunas(int quantidade)
+{
+    numColunas -= quantidade;
+
+    for (int i = 0 ; i < numLinhas ; i++) // Mantém o preenchimento nulo
+        std::fill((*this)[i] + numColunas, (*this)[i] + numColunas + quantidade, 0);
+}
+
+void Matriz::removeLinha(int i)
+{
+    for (int k = i + 1 ; k < numLinhas ; k++)
+        std::memcpy((*this)[k - 1], (*this)[k], numColunas * sizeof(double));
+
+    numLinhas--;
+}
+
+void Matriz::removeColuna(int j)
+{
+    for (int i = 0 ; i < numLinhas ; i++)
+    {
+        double *linha = (*this)[i];
+
+        std::memmove(linha + j, linha + j + 1, (numColunas - j - 1) * sizeof(double));
+        linha[numColunas - 1] = 0; // Mantém o preenchimento nulo
+    }
+
+    numColunas--;
+}
+
+void Matriz::reservaColunas(int colunas)
+{
+    if (calculaPasso(colunas) > passo)
+        realoca(calculaPasso(colunas), capacidadeLinhas);
+}
+
+std::vector<std::vector<double>> Matriz::paraVetor() const
+{
+    std::vector<std::vector<double>> ret;
+
+    for (int i = 0 ; i < numLinhas ; i++)
+        ret.push_back(std::vector<double>((*this)[i], (*this)[i] + numColunas));
+
+    return ret;
+}
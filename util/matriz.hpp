@@ -0,0 +1,155 @@
+#ifndef MATRIZ_H
+#define MATRIZ_H
+
+/**
+ * @file matriz.hpp
+ * @brief Declaração de uma matriz densa armazenada de forma contígua, por linhas, com alinhamento e preenchimento de cada linha.
+ *
+ */
+
+#include <vector>
+#include <cstddef>
+
+/**
+ * @brief Matriz densa de doubles armazenada em um único bloco contíguo de memória, linha após linha.
+ *
+ * Cada linha ocupa "passo" posições, um múltiplo de 8 doubles (64 bytes), e o bloco é alinhado em 64 bytes.
+ * Assim, todas as linhas começam em uma fronteira de linha de cache e podem ser percorridas por instruções vetoriais sem tratamento de borda.
+ * As posições entre o número de colunas e o passo são sempre nulas. Elas servem de capacidade reserva para novas colunas,
+ * permitindo adicionar variáveis de folga ou artificiais sem realocar cada linha. O mesmo vale para as linhas, que possuem capacidade reserva.
+ * O acesso A[i][j] é mantido, pois o operador [] retorna o endereço do início da linha i.
+ */
+
+class Matriz
+{
+    private:
+        double *dados; // Bloco contíguo contendo todas as linhas
+        int numLinhas, numColunas; // Dimensões lógicas da matriz
+        int passo; // Distância, em doubles, entre o início de duas linhas consecutivas
+        int capacidadeLinhas; // Número de linhas que cabem no bloco alocado
+
+        /**
+         * @brief Realoca o bloco para as novas capacidades, copiando as linhas existentes e zerando o restante.
+         *
+         * @param novoPasso O novo passo de cada linha
+         * @param novaCapacidadeLinhas O novo número máximo de linhas
+         */
+
+        void realoca(int novoPasso, int novaCapacidadeLinhas);
+
+    public:
+        static const int ALINHAMENTO = 64; // Alinhamento, em bytes, do bloco e de cada linha
+        static const int DOUBLES_POR_BLOCO = ALINHAMENTO / sizeof(double); // Granularidade do passo
+
+        /**
+         * @brief Cria uma matriz vazia
+         *
+         */
+
+        Matriz();
+
+        /**
+         * @brief Cria uma matriz de zeros com capacidade reserva opcional de linhas e colunas
+         *
+         * @param linhas Número de linhas
+         * @param colunas Número de colunas
+         * @param colunasReserva Número de colunas extras que podem ser adicionadas sem realocação
+         * @param linhasReserva Número de linhas extras que podem ser adicionadas sem realocação
+         */
+
+        Matriz(int linhas, int colunas, int colunasReserva = 0, int linhasReserva = 0);
+
+        /**
+         * @brief Cria uma matriz a partir de um vetor de linhas, como o lido da entrada do usuário
+         *
+         * @param linhas O vetor de linhas. Todas devem ter o mesmo tamanho.
+         * @param colunasReserva Número de colunas extras que podem ser adicionadas sem realocação
+         */
+
+        explicit Matriz(const std::vector<std::vector<double>> &linhas, int colunasReserva = 0);
+
+        Matriz(const Matriz &outra);
+
+        Matriz(Matriz &&outra) noexcept;
+
+        Matriz& operator=(const Matriz &outra);
+
+        Matriz& operator=(Matriz &&outra) noexcept;
+
+        ~Matriz();
+
+        /**
+         * @brief Retorna o endereço do início da linha i, permitindo o acesso A[i][j]
+         *
+         * @param i O índice da linha
+         * @return double* O início da linha
+         */
+
+        double* operator[](int i) { return dados + (std::size_t) i * passo; }
+
+        const double* operator[](int i) const { return dados + (std::size_t) i * passo; }
+
+        int getLinhas() const { return numLinhas; }
+
+        int getColunas() const { return numColunas; }
+
+        int getPasso() const { return passo; }
+
+        /**
+         * @brief Adiciona uma coluna ao final da matriz. Só realoca quando a capacidade reserva se esgota, e então reserva colunas extras.
+         *
+         * @param valores Valor da nova coluna em cada linha. Se vazio, a coluna é preenchida com zeros.
+         */
+
+        void adicionaColuna(const std::vector<double> &valores = std::vector<double>());
+
+        /**
+         * @brief Adiciona uma linha ao final da matriz. Só realoca quando a capacidade reserva se esgota.
+         *
+         * @param valores Os coeficientes da nova linha. Posições além do tamanho do vetor são nulas.
+         */
+
+        void adicionaLinha(const std::vector<double> &valores);
+
+        /**
+         * @brief Remove as últimas colunas da matriz, zerando as posições liberadas. A memória é mantida como capacidade reserva.
+         *
+         * @param quantidade Número de colunas a remover
+         */
+
+        void removeColunas(int quantidade);
+
+        /**
+         * @brief Remove uma linha qualquer, deslocando as seguintes uma posição para cima
+         *
+         * @param i O índice da linha
+         */
+
+        void removeLinha(int i);
+
+        /**
+         * @brief Remove uma coluna qualquer, deslocando as seguintes uma posição para a esquerda em cada linha
+         *
+         * @param j O índice da coluna
+         */
+
+        void removeColuna(int j);
+
+        /**
+         * @brief Garante capacidade para um número de colunas sem realocações futuras
+         *
+         * @param colunas O número total de colunas desejado
+         */
+
+        void reservaColunas(int colunas);
+
+        /**
+         * @brief Converte a matriz para o formato de vetor de linhas
+         *
+         * @return std::vector<std::vector<double>> A cópia da matriz
+         */
+
+        std::vector<std::vector<double>> paraVetor() const;
+};
+
+#endif
@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "matriz_esparsa.hpp"
+
+MatrizEsparsa::MatrizEsparsa() : numLinhas(0), numColunas(0), inicioColunas(1, 0)
+{
+
+}
+
+MatrizEsparsa::MatrizEsparsa(int linhas, int colunas, const std::vector<ElementoEsparso> &elementos)
+    : numLinhas(linhas), numColunas(colunas), inicioColunas(colunas + 1, 0)
+{
+    for (const ElementoEsparso &e : elementos)
+    {
+        if (e.linha < 0 || e.linha >= linhas || e.coluna < 0 || e.coluna >= colunas)
+            throw std::out_of_range("Elemento fora das dimensões da matriz: (" + std::to_string(e.linha + 1) + ", " + std::to_string(e.coluna + 1) + ")");
+
+        inicioColunas[e.coluna + 1]++; // Contagem de elementos por coluna
+    }
+
+    for (int j = 0 ; j < colunas ; j++)
+        inicioColunas[j + 1] += inicioColunas[j];
+
+    std::vector<int> proximaPosicao(inicioColunas.begin(), inicioColunas.end() - 1);
+
+    indicesLinhas.resize(elementos.size());
+    valores.resize(elementos.size());
+
+    for (const ElementoEsparso &e : elementos) // Distribui os elementos nas colunas
+    {
+        indicesLinhas[proximaPosicao[e.coluna]] = e.linha;
+        valores[proximaPosicao[e.coluna]] = e.valor;
+        proximaPosicao[e.coluna]++;
+    }
+
+    /* Ordena cada coluna pela linha, soma os repetidos e descarta os nulos, compactando os vetores */
+
+    int escrita = 0;
+    std::vector<std::pair<int, double>> coluna;
+
+    for (int j = 0 ; j < colunas ; j++)
+    {
+        coluna.clear();
+
+        for (int p = inicioColunas[j] ; p < inicioColunas[j + 1] ; p++)
+            coluna.push_back({indicesLinhas[p], valores[p]});
+
+        std::sort(coluna.begin(), coluna.end(), [](const std::pair<int, double> &a, const std::pair<int, double> &b){ return a.first < b.first; });
+
+        inicioColunas[j] = escrita;
+
+        for (int k = 0 ; k < (int) coluna.size() ; )
+        {
+            int linha = coluna[k].first;
+            double soma = 0;
+
+            for ( ; k < (int) coluna.size() && coluna[k].first == linha ; k++)
+                soma += coluna[k].second;
+
+            if (soma != 0)
+            {
+                indicesLinhas[escrita] = linha;
+                valores[escrita] = soma;
+                escrita++;
+            }
+        }
+    }
+
+    inicioColunas[colunas] = escrita;
+    indicesLinhas.resize(escrita);
+    valores.resize(escrita);
+}
+
+MatrizEsparsa::MatrizEsparsa(const Matriz &densa) : numLinhas(densa.getLinhas()), numColunas(densa.getColunas()), inicioColunas(1, 0)
+{
+    for (int j = 0 ; j < numColunas ; j++)
+    {
+        for (int i = 0 ; i < numLinhas ; i++)
+        {
+            if (densa[i][j] != 0)
+            {
+                indicesLinhas.push_back(i);
+                valores.push_back(densa[i][j]);
+            }
+        }
+
+        inicioColunas.push_back(valores.size());
+    }
+}
+
+void MatrizEsparsa::adicionaColuna(const std::vector<int> &linhas, const std::vector<double> &valoresColuna)
+{
+    indicesLinhas.insert(indicesLinhas.end(), linhas.begin(), linhas.end());
+    valores.insert(valores.end(), valoresColuna.begin(), valoresColuna.end());
+    inicioColunas.push_back(valores.size());
+    numColunas++;
+}
+
+double MatrizEsparsa::produtoColuna(int j, const std::vector<double> &v) const
+{
+    double soma = 0;
+
+    for (int p = inicioColunas[j] ; p < inicioColunas[j + 1] ; p++)
+        soma += valores[p] * v[indicesLinhas[p]];
+
+    return soma;
+}
+
+void MatrizEsparsa::copiaColuna(int j, std::vector<double> &destino) const
+{
+    destino.assign(numLinhas, 0);
+
+    for (int p = inicioColunas[j] ; p < inicioColunas[j + 1] ; p++)
+        destino[indicesLinhas[p]] = valores[p];
+}
+
+double MatrizEsparsa::elemento(int i, int j) const
+{
+    auto inicio = indicesLinhas.begin() + inicioColunas[j];
+    auto fim = indicesLinhas.begin() + inicioColunas[j + 1];
+    auto posicao = std::lower_bound(inicio, fim, i);
+
+    if (posicao == fim || *posicao != i)
+        return 0;
+
+    return valores[posicao - indicesLinhas.begin()];
+}
+
+Matriz MatrizEsparsa::paraDensa(int colunasReserva) const
+{
+    Matriz densa(numLinhas, numColunas, colunasReserva);
+
+    for (int j = 0 ; j < numColunas ; j++)
+    {
+        for (int p = inicioColunas[j] ; p < inicioColunas[j + 1] ; p++)
+            densa[indicesLinhas[p]][j] = valores[p];
+    }
+
+    return densa;
+}
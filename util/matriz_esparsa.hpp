@@ -0,0 +1,138 @@
+#ifndef MATRIZ_ESPARSA_H
+#define MATRIZ_ESPARSA_H
+
+/**
+ * @file matriz_esparsa.hpp
+ * @brief Declaração de uma matriz esparsa armazenada por colunas (formato CSC).
+ *
+ */
+
+#include <vector>
+
+#include "matriz.hpp"
+
+/**
+ * @brief Um coeficiente não nulo da matriz, como fornecido na entrada esparsa.
+ *
+ */
+
+typedef struct
+{
+    int linha;
+    int coluna;
+    double valor;
+} ElementoEsparso;
+
+/**
+ * @brief Matriz esparsa no formato CSC (Compressed Sparse Column).
+ *
+ * Os elementos não nulos da coluna j estão nas posições inicioColunas[j] até inicioColunas[j + 1] - 1 dos vetores
+ * indicesLinhas e valores, ordenados pela linha. A memória utilizada é proporcional ao número de elementos não nulos,
+ * e não ao produto das dimensões. O formato por colunas é o natural para o Simplex revisado, que acessa a matriz
+ * original apenas por colunas: no cálculo dos custos reduzidos e na coluna da variável que entra na base.
+ */
+
+class MatrizEsparsa
+{
+    private:
+        int numLinhas, numColunas; // Dimensões da matriz
+        std::vector<int> inicioColunas; // Início de cada coluna nos vetores de índices e valores, com uma posição extra para o fim da última
+        std::vector<int> indicesLinhas; // Linha de cada elemento não nulo
+        std::vector<double> valores; // Valor de cada elemento não nulo
+
+    public:
+        /**
+         * @brief Cria uma matriz vazia
+         *
+         */
+
+        MatrizEsparsa();
+
+        /**
+         * @brief Cria uma matriz a partir de uma lista de elementos em qualquer ordem. Elementos repetidos são somados e elementos nulos são descartados.
+         *
+         * @param linhas Número de linhas
+         * @param colunas Número de colunas
+         * @param elementos Os elementos não nulos, com índices começando em 0
+         */
+
+        MatrizEsparsa(int linhas, int colunas, const std::vector<ElementoEsparso> &elementos);
+
+        /**
+         * @brief Cria uma matriz esparsa com os elementos não nulos de uma matriz densa
+         *
+         * @param densa A matriz densa
+         */
+
+        explicit MatrizEsparsa(const Matriz &densa);
+
+        int getLinhas() const { return numLinhas; }
+
+        int getColunas() const { return numColunas; }
+
+        int getNaoNulos() const { return valores.size(); }
+
+        /**
+         * @brief Retorna a posição do primeiro elemento da coluna j nos vetores de índices e valores
+         *
+         */
+
+        int inicioColuna(int j) const { return inicioColunas[j]; }
+
+        /**
+         * @brief Retorna a posição seguinte ao último elemento da coluna j nos vetores de índices e valores
+         *
+         */
+
+        int fimColuna(int j) const { return inicioColunas[j + 1]; }
+
+        int linhaElemento(int posicao) const { return indicesLinhas[posicao]; }
+
+        double valorElemento(int posicao) const { return valores[posicao]; }
+
+        /**
+         * @brief Adiciona uma coluna ao final da matriz
+         *
+         * @param linhas As linhas dos elementos não nulos da coluna, em ordem crescente
+         * @param valoresColuna Os valores correspondentes
+         */
+
+        void adicionaColuna(const std::vector<int> &linhas, const std::vector<double> &valoresColuna);
+
+        /**
+         * @brief Calcula o produto interno da coluna j com um vetor denso de tamanho igual ao número de linhas
+         *
+         * @param j O índice da coluna
+         * @param v O vetor denso
+         * @return double O produto interno
+         */
+
+        double produtoColuna(int j, const std::vector<double> &v) const;
+
+        /**
+         * @brief Copia a coluna j para um vetor denso, preenchendo as demais posições com zero
+         *
+         * @param j O índice da coluna
+         * @param destino O vetor denso, redimensionado para o número de linhas
+         */
+
+        void copiaColuna(int j, std::vector<double> &destino) const;
+
+        /**
+         * @brief Retorna o elemento da posição (i, j), com busca binária na coluna
+         *
+         */
+
+        double elemento(int i, int j) const;
+
+        /**
+         * @brief Converte para uma matriz densa, utilizada pelo Simplex tradicional
+         *
+         * @param colunasReserva Número de colunas extras reservadas na matriz densa
+         * @return Matriz A matriz densa equivalente
+         */
+
+        Matriz paraDensa(int colunasReserva = 0) const;
+};
+
+#endif
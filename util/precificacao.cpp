@@ -0,0 +1,244 @@
+#include <cmath>
+#include <algorithm>
+
+#include "precificacao.hpp"
+#include "vetorizacao.hpp"
+
+static const double LIMITE_PESO_DEVEX = 1e6; // Acima desse peso, o referencial do Devex é reiniciado
+static const int NUMERO_SEGMENTOS = 8; // Número de segmentos em que as colunas são divididas na precificação parcial
+static const int TAMANHO_MINIMO_SEGMENTO = 64; // Problemas pequenos são examinados em poucos segmentos
+static const int NUMERO_CANDIDATAS = 8; // Número de colunas guardadas a cada busca da precificação parcial
+
+bool eCustoNegativo(double custo)
+{
+    return std::ceil(custo * 10000000000) / 10000000000 < 0;
+}
+
+/**
+ * @brief Escolhe a coluna com custo negativo que maximiza d_j² / pesos[j]. Em caso de empate, a última coluna é escolhida.
+ *
+ */
+
+static int escolheColunaPonderada(const double *custos, const std::vector<double> &pesos, int n)
+{
+    int escolhida = -1;
+    double melhor = 0;
+
+    for (int j = 0 ; j < n ; j++)
+    {
+        if (!eCustoNegativo(custos[j]))
+            continue;
+
+        double criterio = custos[j] * custos[j] / pesos[j];
+
+        if (criterio >= melhor)
+        {
+            melhor = criterio;
+            escolhida = j;
+        }
+    }
+
+    return escolhida;
+}
+
+int PrecificacaoDantzig::escolheColuna(const double *custos, int n)
+{
+    /* O menor custo é negativo se e somente se algum é, então a otimalidade é verificada apenas nele */
+
+    int escolhida = indiceMenor(custos, n);
+
+    return eCustoNegativo(custos[escolhida]) ? escolhida : -1;
+}
+
+int PrecificacaoDevex::escolheColuna(const double *custos, int n)
+{
+    return escolheColunaPonderada(custos, pesos, n);
+}
+
+void PrecificacaoDevex::inicializa(const std::vector<double> &normasColunas)
+{
+    pesos.assign(normasColunas.size(), 1); // O referencial é formado pelas variáveis não básicas iniciais
+}
+
+void PrecificacaoDevex::atualiza(const DadosPivoteamento &dados)
+{
+    double pesoEntrada = std::max(pesos[dados.entrada], 1.0);
+
+    for (int j = 0 ; j < dados.n ; j++)
+    {
+        if (dados.linhaPivo[j] == 0 || j == dados.entrada)
+            continue;
+
+        double razao = dados.linhaPivo[j] / dados.pivo;
+
+        pesos[j] = std::max(pesos[j], razao * razao * pesoEntrada);
+    }
+
+    pesos[dados.saida] = std::max(pesoEntrada / (dados.pivo * dados.pivo), 1.0);
+
+    if (pesos[dados.saida] > LIMITE_PESO_DEVEX) // Os pesos aproximados perderam a precisão, reiniciamos o referencial
+        pesos.assign(pesos.size(), 1);
+}
+
+int PrecificacaoSteepestEdge::escolheColuna(const double *custos, int n)
+{
+    return escolheColunaPonderada(custos, pesos, n);
+}
+
+void PrecificacaoSteepestEdge::inicializa(const std::vector<double> &normasColunas)
+{
+    pesosLinhas.clear(); // As linhas mudaram de forma que a atualização não acompanha
+    pesos.resize(normasColunas.size());
+
+    for (int j = 0 ; j < (int) normasColunas.size() ; j++)
+        pesos[j] = 1 + normasColunas[j];
+}
+
+void PrecificacaoSteepestEdge::atualiza(const DadosPivoteamento &dados)
+{
+    /*
+    * Atualização de Goldfarb e Reid: com r_j = α_rj / α_rq, a nova norma é γ_j - 2 r_j (α_q^T α_j) + r_j² γ_q.
+    * A norma da coluna que entra é recalculada exatamente, eliminando o erro acumulado nela.
+    */
+
+    double pesoEntrada = 1 + dados.normaColuna;
+
+    for (int j = 0 ; j < dados.n ; j++)
+    {
+        if (dados.linhaPivo[j] == 0 || j == dados.entrada)
+            continue;
+
+        double razao = dados.linhaPivo[j] / dados.pivo;
+
+        pesos[j] = std::max(pesos[j] - 2 * razao * dados.produtos[j] + razao * razao * pesoEntrada, 1 + razao * razao);
+    }
+
+    pesos[dados.saida] = std::max(pesoEntrada / (dados.pivo * dados.pivo), 1.0);
+}
+
+void PrecificacaoSteepestEdge::redimensiona(int n)
+{
+    pesos.resize(n, 1);
+    pesosLinhas.clear(); // A remoção de colunas altera a norma das linhas, e uma linha nova não tem peso
+}
+
+void PrecificacaoSteepestEdge::inicializaPesosLinhas(const std::vector<double> &normasLinhas)
+{
+    pesosLinhas = normasLinhas;
+}
+
+void PrecificacaoSteepestEdge::atualizaPesosLinhas(const DadosPivoteamentoLinhas &dados)
+{
+    /*
+    * Com r_i = α_iq / α_rq, a nova linha i é ρ_i - r_i ρ_r, e a nova norma é β_i - 2 r_i (ρ_i^T ρ_r) + r_i² β_r.
+    * A nova linha pivô é ρ_r / α_rq. A norma da linha pivô é recalculada exatamente, pelo produto dela com ela mesma.
+    * As linhas com α_iq nulo não mudam. Cada linha contém o 1 da sua variável básica, então o peso não fica abaixo de 1.
+    */
+
+    double pesoPivo = dados.produtos[dados.linhaPivo];
+
+    for (int i = 0 ; i < dados.m ; i++)
+    {
+        if (dados.colunaEntrada[i] == 0 || i == dados.linhaPivo)
+            continue;
+
+        double razao = dados.colunaEntrada[i] / dados.pivo;
+
+        pesosLinhas[i] = std::max(pesosLinhas[i] - 2 * razao * dados.produtos[i] + razao * razao * pesoPivo, 1.0);
+    }
+
+    pesosLinhas[dados.linhaPivo] = std::max(pesoPivo / (dados.pivo * dados.pivo), 1.0);
+}
+
+int PrecificacaoParcial::escolheColuna(const double *custos, int n)
+{
+    int escolhida = -1;
+
+    for (int j : candidatas) // Iteração menor: apenas as candidatas da última busca
+    {
+        if (eCustoNegativo(custos[j]) && (escolhida == -1 || custos[j] <= custos[escolhida]))
+            escolhida = j;
+    }
+
+    if (escolhida != -1)
+    {
+        candidatas.erase(std::find(candidatas.begin(), candidatas.end(), escolhida));
+        return escolhida;
+    }
+
+    candidatas.clear();
+
+    int tamanhoSegmento = std::max(TAMANHO_MINIMO_SEGMENTO, (n + NUMERO_SEGMENTOS - 1) / NUMERO_SEGMENTOS);
+
+    for (int examinadas = 0 ; examinadas < n && candidatas.empty() ; ) // Examina segmentos até encontrar custos negativos ou dar uma volta completa
+    {
+        int fim = std::min(examinadas + tamanhoSegmento, n);
+
+        for ( ; examinadas < fim ; examinadas++)
+        {
+            int j = (inicioSegmento + examinadas) % n;
+
+            if (eCustoNegativo(custos[j]))
+                candidatas.push_back(j);
+        }
+    }
+
+    inicioSegmento = (inicioSegmento + tamanhoSegmento) % n;
+
+    if (candidatas.empty())
+        return -1;
+
+    auto ordem = [custos](int a, int b){ return custos[a] < custos[b]; };
+
+    if ((int) candidatas.size() > NUMERO_CANDIDATAS) // Guarda apenas as mais atrativas
+    {
+        std::nth_element(candidatas.begin(), candidatas.begin() + NUMERO_CANDIDATAS, candidatas.end(), ordem);
+        candidatas.resize(NUMERO_CANDIDATAS);
+    }
+
+    auto melhor = std::min_element(candidatas.begin(), candidatas.end(), ordem);
+
+    escolhida = *melhor;
+    candidatas.erase(melhor);
+
+    return escolhida;
+}
+
+void PrecificacaoParcial::redimensiona(int n)
+{
+    candidatas.erase(std::remove_if(candidatas.begin(), candidatas.end(), [n](int j){ return j >= n; }), candidatas.end());
+
+    if (inicioSegmento >= n)
+        inicioSegmento = 0;
+}
+
+Precificacao::Precificacao(RegraPrecificacao regra)
+{
+    switch (regra)
+    {
+        case RegraPrecificacao::DEVEX:
+            estrategia.reset(new PrecificacaoDevex());
+            break;
+        case RegraPrecificacao::STEEPEST_EDGE:
+            estrategia.reset(new PrecificacaoSteepestEdge());
+            break;
+        case RegraPrecificacao::PARCIAL:
+            estrategia.reset(new PrecificacaoParcial());
+            break;
+        default:
+            estrategia.reset(new PrecificacaoDantzig());
+    }
+}
+
+Precificacao::Precificacao(const Precificacao &outra) : estrategia(outra.estrategia->clona())
+{
+
+}
+
+Precificacao &Precificacao::operator=(const Precificacao &outra)
+{
+    if (this != &outra)
+        estrategia.reset(outra.estrategia->clona());
+
+    return *this;
+}
@@ -0,0 +1,292 @@
+#ifndef PRECIFICACAO_H
+#define PRECIFICACAO_H
+
+/**
+ * @file precificacao.hpp
+ * @brief Declaração das estratégias de precificação, que escolhem a variável que entra na base a cada iteração do Simplex.
+ *
+ */
+
+#include <vector>
+#include <memory>
+
+/**
+ * @brief Regras de precificação disponíveis.
+ *
+ */
+
+enum class RegraPrecificacao
+{
+    DANTZIG, // Custo reduzido mais negativo
+    DEVEX, // Custo reduzido normalizado por pesos aproximados da norma das arestas, em relação a um referencial
+    STEEPEST_EDGE, // Custo reduzido normalizado pela norma exata das arestas, no primal e no dual
+    PARCIAL // Apenas um segmento das colunas é examinado, guardando uma lista de candidatas para as próximas iterações
+};
+
+/**
+ * @brief Dados de uma troca de base, utilizados na atualização dos pesos. Os valores são os anteriores ao pivoteamento.
+ *
+ */
+
+typedef struct
+{
+    int entrada; // Variável que entra na base
+    int saida; // Variável que sai da base
+    double pivo; // O número pivô
+    const double *linhaPivo; // A linha pivô do tableau, com um elemento por coluna
+    double normaColuna; // Soma dos quadrados da coluna da variável que entra no tableau
+    const double *produtos; // Produto interno da coluna da variável que entra com cada coluna do tableau. Nulo se não for utilizado
+    int n; // Número de colunas
+} DadosPivoteamento;
+
+/**
+ * @brief Dados de uma troca de base utilizados na atualização dos pesos das linhas do Simplex dual. Os valores são os anteriores ao pivoteamento.
+ *
+ */
+
+typedef struct
+{
+    int linhaPivo; // Linha da variável que sai da base
+    double pivo; // O número pivô
+    const double *colunaEntrada; // A coluna da variável que entra no tableau, com um elemento por linha
+    const double *produtos; // Produto interno da linha pivô com cada linha de elemento não nulo na coluna que entra. As demais são ignoradas
+    int m; // Número de linhas
+} DadosPivoteamentoLinhas;
+
+/**
+ * @brief Verifica se o custo reduzido permite melhorar a solução, com a mesma tolerância de 10 casas decimais utilizada desde a primeira versão do Simplex.
+ *
+ * @param custo O custo reduzido
+ * @return true Se o custo é negativo
+ */
+
+bool eCustoNegativo(double custo);
+
+/**
+ * @brief Interface das estratégias de precificação.
+ *
+ * A escolha da coluna e a verificação de otimalidade são feitas na mesma passagem pelos custos reduzidos. As estratégias com
+ * pesos os mantêm entre as iterações, então declaram quais dados da troca de base precisam receber, para que o Simplex calcule apenas o necessário.
+ */
+
+class EstrategiaPrecificacao
+{
+    public:
+        virtual ~EstrategiaPrecificacao() = default;
+
+        /**
+         * @brief Escolhe a variável que entra na base.
+         *
+         * @param custos Os custos reduzidos da fase atual. Colunas que não podem entrar na base devem ter custo infinito
+         * @param n O número de colunas
+         * @return int O índice da coluna escolhida, ou -1 se nenhum custo é negativo, ou seja, a solução é ótima
+         */
+
+        virtual int escolheColuna(const double *custos, int n) = 0;
+
+        /**
+         * @brief Inicializa os pesos para a base inicial.
+         *
+         * @param normasColunas Soma dos quadrados de cada coluna do tableau inicial, calculada apenas se usaProdutos retorna true
+         */
+
+        virtual void inicializa(const std::vector<double> &normasColunas) {}
+
+        /**
+         * @brief Atualiza os pesos após uma troca de base, antes do pivoteamento.
+         *
+         */
+
+        virtual void atualiza(const DadosPivoteamento &dados) {}
+
+        /**
+         * @brief Descarta os pesos das últimas colunas, removidas do problema ao fim da primeira fase.
+         *
+         * @param n O novo número de colunas
+         */
+
+        virtual void redimensiona(int n) {}
+
+        /**
+         * @brief Indica se a linha pivô deve ser fornecida em atualiza
+         *
+         */
+
+        virtual bool usaLinhaPivo() const { return false; }
+
+        /**
+         * @brief Indica se as normas iniciais e os produtos internos com a coluna que entra devem ser fornecidos
+         *
+         */
+
+        virtual bool usaProdutos() const { return false; }
+
+        /**
+         * @brief Indica se o Simplex dual deve normalizar a violação de cada linha pelo peso da linha
+         *
+         */
+
+        virtual bool usaNormaLinhas() const { return false; }
+
+        /**
+         * @brief Inicializa os pesos das linhas do Simplex dual
+         *
+         * @param normasLinhas Soma dos quadrados de cada linha do tableau atual
+         */
+
+        virtual void inicializaPesosLinhas(const std::vector<double> &normasLinhas) {}
+
+        /**
+         * @brief Atualiza os pesos das linhas após uma troca de base, antes do pivoteamento. Só é chamada com pesos inicializados
+         *
+         */
+
+        virtual void atualizaPesosLinhas(const DadosPivoteamentoLinhas &dados) {}
+
+        /**
+         * @brief Retorna o número de linhas com peso. Diferente do número de linhas do tableau se os pesos não estão inicializados
+         *
+         */
+
+        virtual int numPesosLinhas() const { return 0; }
+
+        /**
+         * @brief Retorna o peso de uma linha no Simplex dual
+         *
+         */
+
+        virtual double pesoLinha(int i) const { return 1; }
+
+        /**
+         * @brief Retorna uma cópia da estratégia, com os seus pesos
+         *
+         */
+
+        virtual EstrategiaPrecificacao *clona() const = 0;
+};
+
+/**
+ * @brief Regra de Dantzig: o custo reduzido mais negativo. Em caso de empate, a última coluna é escolhida.
+ *
+ */
+
+class PrecificacaoDantzig : public EstrategiaPrecificacao
+{
+    public:
+        int escolheColuna(const double *custos, int n) override;
+
+        EstrategiaPrecificacao *clona() const override { return new PrecificacaoDantzig(*this); }
+};
+
+/**
+ * @brief Regra Devex: maximiza d_j² / w_j, onde os pesos w_j aproximam a norma das arestas em relação ao referencial
+ * das variáveis não básicas iniciais. O referencial é reiniciado quando os pesos crescem demais.
+ *
+ */
+
+class PrecificacaoDevex : public EstrategiaPrecificacao
+{
+    private:
+        std::vector<double> pesos; // Peso de cada coluna
+
+    public:
+        int escolheColuna(const double *custos, int n) override;
+
+        void inicializa(const std::vector<double> &normasColunas) override;
+
+        void atualiza(const DadosPivoteamento &dados) override;
+
+        void redimensiona(int n) override { pesos.resize(n, 1); }
+
+        bool usaLinhaPivo() const override { return true; }
+
+        EstrategiaPrecificacao *clona() const override { return new PrecificacaoDevex(*this); }
+};
+
+/**
+ * @brief Regra steepest edge: maximiza d_j² / γ_j, onde γ_j = 1 + ||B^{-1} a_j||² é a norma da aresta de cada coluna,
+ * atualizada exatamente a cada troca de base. No Simplex dual, a linha que sai maximiza a violação ao quadrado dividida por β_i,
+ * a norma da linha do tableau, calculada uma vez e atualizada a cada troca de base pelas linhas alteradas pelo pivoteamento.
+ * Os pesos das linhas são descartados quando colunas ou linhas são removidas ou adicionadas, e recalculados no próximo Simplex dual.
+ *
+ */
+
+class PrecificacaoSteepestEdge : public EstrategiaPrecificacao
+{
+    private:
+        std::vector<double> pesos; // Norma da aresta de cada coluna
+        std::vector<double> pesosLinhas; // Norma de cada linha do tableau, no Simplex dual. Vazio se não estão inicializados
+
+    public:
+        int escolheColuna(const double *custos, int n) override;
+
+        void inicializa(const std::vector<double> &normasColunas) override;
+
+        void atualiza(const DadosPivoteamento &dados) override;
+
+        void redimensiona(int n) override;
+
+        bool usaLinhaPivo() const override { return true; }
+
+        bool usaProdutos() const override { return true; }
+
+        bool usaNormaLinhas() const override { return true; }
+
+        void inicializaPesosLinhas(const std::vector<double> &normasLinhas) override;
+
+        void atualizaPesosLinhas(const DadosPivoteamentoLinhas &dados) override;
+
+        int numPesosLinhas() const override { return pesosLinhas.size(); }
+
+        double pesoLinha(int i) const override { return pesosLinhas[i]; }
+
+        EstrategiaPrecificacao *clona() const override { return new PrecificacaoSteepestEdge(*this); }
+};
+
+/**
+ * @brief Precificação parcial com múltiplas candidatas. Cada busca completa examina segmentos de colunas, a partir de onde a anterior parou,
+ * até encontrar custos negativos, e guarda as melhores colunas do segmento. As iterações seguintes examinam apenas essas candidatas,
+ * enquanto alguma continuar atrativa. A solução é declarada ótima somente após uma volta completa sem custos negativos.
+ *
+ */
+
+class PrecificacaoParcial : public EstrategiaPrecificacao
+{
+    private:
+        int inicioSegmento = 0; // Primeira coluna do próximo segmento a ser examinado
+        std::vector<int> candidatas; // Colunas atrativas da última busca, ainda não escolhidas
+
+    public:
+        int escolheColuna(const double *custos, int n) override;
+
+        void redimensiona(int n) override;
+
+        EstrategiaPrecificacao *clona() const override { return new PrecificacaoParcial(*this); }
+};
+
+/**
+ * @brief Guarda a estratégia de precificação de um Simplex. A cópia copia também os pesos, pois cada nó do Branch and Bound
+ * parte da base do nó pai.
+ *
+ */
+
+class Precificacao
+{
+    private:
+        std::unique_ptr<EstrategiaPrecificacao> estrategia; // A estratégia em uso
+
+    public:
+        explicit Precificacao(RegraPrecificacao regra = RegraPrecificacao::DANTZIG);
+
+        Precificacao(const Precificacao &outra);
+
+        Precificacao &operator=(const Precificacao &outra);
+
+        Precificacao(Precificacao &&outra) = default;
+
+        Precificacao &operator=(Precificacao &&outra) = default;
+
+        EstrategiaPrecificacao *operator->() const { return estrategia.get(); }
+};
+
+#endif
@@ -1,7 +1,7 @@
 #include "preparador.hpp"
 
 
-PreparacaoSimplex retornaPreparacaoSimplex(std::vector< std::vector<double>> a, int tamanhoLinhaA, int tamanhoColunaA, int numVars)
+PreparacaoSimplex retornaPreparacaoSimplex(const Matriz &a, int tamanhoLinhaA, int tamanhoColunaA, int numVars)
 {
     PreparacaoSimplex ret; 
 
@@ -37,18 +37,64 @@ PreparacaoSimplex retornaPreparacaoSimplex(std::vector< std::vector<double>> a,
     return ret;
 }
 
-void adicionaVariaveisArtificiais(std::vector<std::vector<double>> &a, std::vector<double> &c, int &tamanhoColunaA, int tamanhoLinhaA, PreparacaoSimplex preparador)
+PreparacaoSimplex retornaPreparacaoSimplex(const MatrizEsparsa &a, int tamanhoLinhaA, int tamanhoColunaA, int numVars)
 {
-    for (int k = 0 ; k < (int) preparador.ondeAdicionar.size() ; k++)
+    PreparacaoSimplex ret;
+    std::vector<int> numFolgasNegativas(tamanhoLinhaA, 0); // Coeficientes negativos nas variáveis de folga de cada linha
+    std::vector<bool> temFolgaUnitaria(tamanhoLinhaA, false); // Indica se a linha possui alguma variável de folga com coeficiente 1
+
+    for (int j = numVars ; j < tamanhoColunaA ; j++)
     {
-        for (int i = 0 ; i < tamanhoLinhaA ; i++)
+        for (int p = a.inicioColuna(j) ; p < a.fimColuna(j) ; p++)
         {
-            if (i != preparador.ondeAdicionar[k]) // Se não estiver no vetor, é uma restrição de menor ou igual que
-                a[i].push_back(0);
-            else // Caso contrário, é uma restrição maior ou igual que ou uma igualdade
-                a[i].push_back(1);
+            if (a.valorElemento(p) < 0)
+                numFolgasNegativas[a.linhaElemento(p)]++;
+            else if (a.valorElemento(p) == 1)
+                temFolgaUnitaria[a.linhaElemento(p)] = true;
         }
+    }
+
+    for (int i = 0 ; i < tamanhoLinhaA ; i++) // Mesma ordem e mesmos critérios da versão densa
+    {
+        for (int k = 0 ; k < numFolgasNegativas[i] ; k++) // Restrição >=
+        {
+            ret.eDuasFases = true;
+            ret.ondeAdicionar.push_back(i);
+            ret.numVarArtificiais++;
+        }
+
+        if (numFolgasNegativas[i] == 0 && !temFolgaUnitaria[i]) // Restrição =
+        {
+            ret.eDuasFases = true;
+            ret.ondeAdicionar.push_back(i);
+            ret.numVarArtificiais++;
+        }
+    }
+
+    return ret;
+}
+
+void adicionaVariaveisArtificiais(Matriz &a, std::vector<double> &c, int &tamanhoColunaA, int tamanhoLinhaA, PreparacaoSimplex preparador)
+{
+    a.reservaColunas(tamanhoColunaA + preparador.ondeAdicionar.size());
+
+    for (int k = 0 ; k < (int) preparador.ondeAdicionar.size() ; k++)
+    {
+        a.adicionaColuna(); // A nova coluna é nula nas restrições de menor ou igual que
+        a[preparador.ondeAdicionar[k]][tamanhoColunaA] = 1; // A restrição maior ou igual que ou a igualdade recebe 1
+
         tamanhoColunaA++; // Aumenta o número de coeficientes no problema
         c.push_back(0);
     }
 }
+
+void adicionaVariaveisArtificiais(MatrizEsparsa &a, std::vector<double> &c, int &tamanhoColunaA, PreparacaoSimplex preparador)
+{
+    for (int k = 0 ; k < (int) preparador.ondeAdicionar.size() ; k++)
+    {
+        a.adicionaColuna({preparador.ondeAdicionar[k]}, {1}); // Apenas a restrição maior ou igual que ou a igualdade recebe 1
+
+        tamanhoColunaA++;
+        c.push_back(0);
+    }
+}
@@ -9,6 +9,9 @@
 
 #include <vector>
 
+#include "matriz.hpp"
+#include "matriz_esparsa.hpp"
+
 /**
  * @brief Contém as variáveis utilizadas para a estrutura da primeira fase de um PPL.
  * 
@@ -31,10 +34,24 @@ typedef struct
  * @return PreparacaoSimplex A estrutura contendo a sinalização da necessidade de duas fases, o número de variáveis artificiais e o vetor com índices de onde colocá-las
  */
 
-PreparacaoSimplex retornaPreparacaoSimplex(std::vector< std::vector<double>> a, int tamanhoLinhaA, int tamanhoColunaA, int numVars);
+PreparacaoSimplex retornaPreparacaoSimplex(const Matriz &a, int tamanhoLinhaA, int tamanhoColunaA, int numVars);
+
+/**
+ * @brief Versão para a matriz esparsa. Percorre apenas os elementos não nulos das colunas de folga.
+ *
+ * @param a A matriz de coeficientes do problema de programação de linear
+ * @param tamanhoLinhaA // Número de restrições do problema
+ * @param tamanhoColunaA // Número de coeficientes do problema na forma padrão
+ * @param numVars // Número de variáveis na forma canônica
+ * @return PreparacaoSimplex A estrutura contendo a sinalização da necessidade de duas fases, o número de variáveis artificiais e o vetor com índices de onde colocá-las
+ */
+
+PreparacaoSimplex retornaPreparacaoSimplex(const MatrizEsparsa &a, int tamanhoLinhaA, int tamanhoColunaA, int numVars);
 
 /**
  * @brief Adiciona as variáveis artificiais no problema. As linhas de desigualdades maior ou igual que e as igualdades recebem 1 na coluna. Caso contrário, recebem 0.
+ *
+ * As colunas são reservadas de uma só vez na matriz, evitando realocações a cada variável artificial.
  * 
  * @param a A matriz de coeficientes do problema de programação linear
  * @param c O vetor de coeficientes da função objetivo
@@ -43,7 +60,18 @@ PreparacaoSimplex retornaPreparacaoSimplex(std::vector< std::vector<double>> a,
  * @param preparador A estrutura contendo o vetor de índices das linhas que possuem desigualdades maior ou igual que ou igualdades.
  */
 
-void adicionaVariaveisArtificiais(std::vector<std::vector<double>> &a, std::vector<double> &c, int &tamanhoColunaA, int tamanhoLinhaA, PreparacaoSimplex preparador);
+void adicionaVariaveisArtificiais(Matriz &a, std::vector<double> &c, int &tamanhoColunaA, int tamanhoLinhaA, PreparacaoSimplex preparador);
+
+/**
+ * @brief Versão para a matriz esparsa. Cada variável artificial é uma coluna com um único elemento não nulo.
+ *
+ * @param a A matriz de coeficientes do problema de programação linear
+ * @param c O vetor de coeficientes da função objetivo
+ * @param tamanhoColunaA Número de coeficientes do problema na forma padrão
+ * @param preparador A estrutura contendo o vetor de índices das linhas que possuem desigualdades maior ou igual que ou igualdades.
+ */
+
+void adicionaVariaveisArtificiais(MatrizEsparsa &a, std::vector<double> &c, int &tamanhoColunaA, PreparacaoSimplex preparador);
 
 /**
  * @brief Função de cópia profunda de um vetor de qualquer tipo.
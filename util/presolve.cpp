@@ -0,0 +1,926 @@
+#include <cmath>
+#include <limits>
+#include <map>
+#include <algorithm>
+#include <utility>
+
+#include "presolve.hpp"
+
+static const double TOLERANCIA_PRESOLVE = 1e-9; // Tolerância relativa das comparações com o lado direito e com os limites
+static const double MELHORA_MINIMA_LIMITE = 1e-3; // Melhora relativa mínima para que um limite implícito substitua o atual, evitando apertos infinitesimais
+static const double ESCALA_CHAVE = 1e9; // Escala dos coeficientes normalizados na chave de comparação de restrições duplicadas
+static const int MAXIMO_PASSADAS = 50; // Número máximo de passadas pelas reduções
+
+static const double INFINITO = std::numeric_limits<double>::infinity();
+
+/**
+ * @brief Sentido de uma restrição, identificado pela variável de folga na entrada.
+ *
+ */
+
+enum class SentidoRestricao
+{
+    MENOR_IGUAL,
+    MAIOR_IGUAL,
+    IGUALDADE
+};
+
+/**
+ * @brief Problema em reformulação: as restrições na forma a_i x (<=, >=, =) b_i sem as folgas, com 0 <= x <= u.
+ * Os coeficientes são guardados por linhas e por colunas, e as linhas e colunas removidas são apenas desativadas.
+ *
+ */
+
+typedef struct
+{
+    int numLinhas; // Número de restrições originais
+    int numColunas; // Número de variáveis da forma canônica originais
+    std::vector< std::vector< std::pair<int, double> > > linhas; // Coeficientes de cada restrição: (coluna, valor)
+    std::vector< std::vector< std::pair<int, double> > > colunas; // Coeficientes de cada variável: (restrição, valor)
+    std::vector<bool> linhaAtiva; // Indica se a restrição continua no problema
+    std::vector<bool> colunaAtiva; // Indica se a variável continua no problema
+    std::vector<int> tamanhoLinha; // Número de variáveis ativas em cada restrição
+    std::vector<int> tamanhoColuna; // Número de restrições ativas em cada variável
+    std::vector<SentidoRestricao> sentido; // Sentido de cada restrição
+    std::vector<int> folga; // Variável original que é a folga de cada restrição, ou -1 se for uma igualdade
+    std::vector<double> b; // Lado direito, descontadas as variáveis fixadas
+    std::vector<double> c; // Coeficientes da função objetivo, como fornecidos
+    std::vector<double> u; // Limite superior de cada variável
+    bool tipoProblema; // true se é de maximização
+    bool aceitaLimites; // Indica se os limites alterados podem ser passados ao Simplex
+    ReducaoPresolve *reducao; // Resultado, onde as reduções são registradas
+} ModeloPresolve;
+
+static double tolerancia(double valor)
+{
+    return TOLERANCIA_PRESOLVE * (1 + std::fabs(valor));
+}
+
+/**
+ * @brief Custo da variável na convenção do tableau: negativo se aumentar a variável melhora o objetivo
+ *
+ */
+
+static double custoInterno(const ModeloPresolve &modelo, int j)
+{
+    return modelo.tipoProblema ? modelo.c[j] : -modelo.c[j];
+}
+
+static void registraOperacao(ModeloPresolve &modelo, TipoReducao tipo, int linha, int coluna, double valor)
+{
+    OperacaoPostsolve operacao;
+
+    operacao.tipo = tipo;
+    operacao.linha = linha;
+    operacao.coluna = coluna;
+    operacao.valor = valor;
+    operacao.coeficiente = 0;
+
+    modelo.reducao->operacoes.push_back(operacao);
+}
+
+/**
+ * @brief Fixa a variável em um valor, movendo a sua contribuição para o lado direito das restrições e para a constante do objetivo
+ *
+ */
+
+static void fixaColuna(ModeloPresolve &modelo, int j, double valor)
+{
+    for (auto &elemento : modelo.colunas[j])
+    {
+        if (!modelo.linhaAtiva[elemento.first])
+            continue;
+
+        modelo.b[elemento.first] -= elemento.second * valor;
+        modelo.tamanhoLinha[elemento.first]--;
+    }
+
+    modelo.colunaAtiva[j] = false;
+    modelo.reducao->constanteObjetivo += modelo.c[j] * valor;
+
+    registraOperacao(modelo, TipoReducao::FIXA_COLUNA, -1, j, valor);
+}
+
+/**
+ * @brief Remove a restrição do problema
+ *
+ * @param basica A variável original que fica básica na restrição removida, ou -1
+ */
+
+static void removeLinha(ModeloPresolve &modelo, int i, int basica)
+{
+    for (auto &elemento : modelo.linhas[i])
+    {
+        if (modelo.colunaAtiva[elemento.first])
+            modelo.tamanhoColuna[elemento.first]--;
+    }
+
+    modelo.linhaAtiva[i] = false;
+
+    registraOperacao(modelo, TipoReducao::REMOVE_LINHA, i, basica, 0);
+}
+
+/**
+ * @brief Calcula a menor e a maior atividade a_i x da restrição com as variáveis ativas em [0, u]
+ *
+ */
+
+static void calculaAtividade(const ModeloPresolve &modelo, int i, double &minima, double &maxima)
+{
+    minima = maxima = 0;
+
+    for (auto &elemento : modelo.linhas[i])
+    {
+        if (!modelo.colunaAtiva[elemento.first])
+            continue;
+
+        double extremo = elemento.second * modelo.u[elemento.first]; // Infinito se a variável não tem limite superior
+
+        if (elemento.second > 0)
+            maxima += extremo;
+        else
+            minima += extremo;
+    }
+}
+
+/**
+ * @brief Fixa todas as variáveis da restrição no limite que leva à atividade mínima ou máxima, que é a única que satisfaz a restrição
+ *
+ */
+
+static void fixaRestricaoForcante(ModeloPresolve &modelo, int i, bool naMinima)
+{
+    std::vector< std::pair<int, double> > fixacoes;
+
+    for (auto &elemento : modelo.linhas[i])
+    {
+        if (modelo.colunaAtiva[elemento.first])
+            fixacoes.push_back( {elemento.first, (elemento.second > 0) == naMinima ? 0 : modelo.u[elemento.first]} );
+    }
+
+    removeLinha(modelo, i, modelo.folga[i] != -1 ? modelo.folga[i] : fixacoes[0].first);
+
+    for (auto &fixacao : fixacoes)
+        fixaColuna(modelo, fixacao.first, fixacao.second);
+}
+
+/**
+ * @brief Trata uma restrição com uma única variável: uma igualdade a fixa, e uma desigualdade é um limite dela
+ *
+ * @return true Se houve redução
+ */
+
+static bool reduzLinhaUnitaria(ModeloPresolve &modelo, int i)
+{
+    int j = -1;
+    double a = 0;
+
+    for (auto &elemento : modelo.linhas[i])
+    {
+        if (modelo.colunaAtiva[elemento.first])
+        {
+            j = elemento.first;
+            a = elemento.second;
+        }
+    }
+
+    double razao = modelo.b[i] / a;
+    double tol = tolerancia(razao);
+
+    if (modelo.sentido[i] == SentidoRestricao::IGUALDADE)
+    {
+        if (razao < -tol || razao > modelo.u[j] + tol)
+        {
+            modelo.reducao->semSolucao = true;
+            return true;
+        }
+
+        removeLinha(modelo, i, j);
+        fixaColuna(modelo, j, std::min(std::max(razao, 0.0), modelo.u[j]));
+
+        return true;
+    }
+
+    bool eLimiteSuperior = (modelo.sentido[i] == SentidoRestricao::MENOR_IGUAL) == (a > 0); // x_j <= razao ou x_j >= razao
+
+    if (eLimiteSuperior)
+    {
+        if (razao < -tol)
+            modelo.reducao->semSolucao = true;
+
+        else if (razao <= tol) // x_j <= 0
+        {
+            removeLinha(modelo, i, modelo.folga[i]);
+            fixaColuna(modelo, j, 0);
+        }
+
+        else if (razao >= modelo.u[j] - tol) // O limite atual já é mais justo
+            removeLinha(modelo, i, modelo.folga[i]);
+
+        else if (modelo.aceitaLimites)
+        {
+            modelo.u[j] = razao;
+            removeLinha(modelo, i, modelo.folga[i]);
+        }
+
+        else
+            return false;
+
+        return true;
+    }
+
+    if (razao <= tol) // x_j >= 0 já é garantido
+        removeLinha(modelo, i, modelo.folga[i]);
+
+    else if (razao > modelo.u[j] + tol)
+        modelo.reducao->semSolucao = true;
+
+    else if (razao >= modelo.u[j] - tol) // O intervalo se reduz ao limite superior
+    {
+        removeLinha(modelo, i, modelo.folga[i]);
+        fixaColuna(modelo, j, modelo.u[j]);
+    }
+
+    else
+        return false; // Limites inferiores não são suportados pelo Simplex, então a restrição permanece
+
+    return true;
+}
+
+/**
+ * @brief Compara a atividade mínima e máxima da restrição com o lado direito, detectando inviabilidade, redundância e restrições forçantes
+ *
+ * @return true Se houve redução
+ */
+
+static bool reduzLinhaPorAtividade(ModeloPresolve &modelo, int i)
+{
+    double minima, maxima;
+    double b = modelo.b[i];
+    double tol = tolerancia(b);
+
+    calculaAtividade(modelo, i, minima, maxima);
+
+    bool temMenor = modelo.sentido[i] != SentidoRestricao::MAIOR_IGUAL; // a_i x <= b
+    bool temMaior = modelo.sentido[i] != SentidoRestricao::MENOR_IGUAL; // a_i x >= b
+
+    if ((temMenor && minima > b + tol) || (temMaior && maxima < b - tol))
+    {
+        modelo.reducao->semSolucao = true;
+        return true;
+    }
+
+    if (temMenor && temMaior)
+    {
+        if (minima >= b - tol)
+            fixaRestricaoForcante(modelo, i, true);
+        else if (maxima <= b + tol)
+            fixaRestricaoForcante(modelo, i, false);
+        else
+            return false;
+
+        return true;
+    }
+
+    if (temMenor)
+    {
+        if (maxima <= b + tol) // Qualquer valor das variáveis satisfaz a restrição
+            removeLinha(modelo, i, modelo.folga[i]);
+        else if (minima >= b - tol)
+            fixaRestricaoForcante(modelo, i, true);
+        else
+            return false;
+
+        return true;
+    }
+
+    if (minima >= b - tol)
+        removeLinha(modelo, i, modelo.folga[i]);
+    else if (maxima <= b + tol)
+        fixaRestricaoForcante(modelo, i, false);
+    else
+        return false;
+
+    return true;
+}
+
+/**
+ * @brief Percorre as restrições ativas, aplicando as reduções de restrições vazias, unitárias e pela atividade
+ *
+ * @return true Se houve redução
+ */
+
+static bool reduzLinhas(ModeloPresolve &modelo)
+{
+    bool houveReducao = false;
+
+    for (int i = 0 ; i < modelo.numLinhas && !modelo.reducao->semSolucao ; i++)
+    {
+        if (!modelo.linhaAtiva[i])
+            continue;
+
+        if (modelo.tamanhoLinha[i] == 0) // 0 (<=, >=, =) b
+        {
+            double b = modelo.b[i];
+            double tol = tolerancia(b);
+
+            if ((modelo.sentido[i] != SentidoRestricao::MAIOR_IGUAL && b < -tol) || (modelo.sentido[i] != SentidoRestricao::MENOR_IGUAL && b > tol))
+                modelo.reducao->semSolucao = true;
+            else
+                removeLinha(modelo, i, modelo.folga[i]);
+
+            houveReducao = true;
+        }
+
+        else if (modelo.tamanhoLinha[i] == 1)
+            houveReducao = reduzLinhaUnitaria(modelo, i) || houveReducao;
+
+        else
+            houveReducao = reduzLinhaPorAtividade(modelo, i) || houveReducao;
+    }
+
+    return houveReducao;
+}
+
+/**
+ * @brief Verifica se a variável é uma folga implícita: aparece apenas em uma igualdade, com coeficiente 1 ou -1, sem limite superior,
+ * e a restrição tem os demais coeficientes e o lado direito inteiros, para que a folga seja inteira sempre que as demais variáveis forem.
+ *
+ * @return int A restrição da variável, ou -1 se ela não é uma folga implícita
+ */
+
+static int linhaFolgaImplicita(const ModeloPresolve &modelo, int j)
+{
+    if (modelo.tamanhoColuna[j] != 1 || modelo.u[j] != INFINITO)
+        return -1;
+
+    int i = -1;
+    double a = 0;
+
+    for (auto &elemento : modelo.colunas[j])
+    {
+        if (modelo.linhaAtiva[elemento.first])
+        {
+            i = elemento.first;
+            a = elemento.second;
+        }
+    }
+
+    if (modelo.sentido[i] != SentidoRestricao::IGUALDADE || std::fabs(a) != 1 || modelo.tamanhoLinha[i] < 2 || std::floor(modelo.b[i]) != modelo.b[i])
+        return -1;
+
+    for (auto &elemento : modelo.linhas[i])
+    {
+        if (modelo.colunaAtiva[elemento.first] && std::floor(elemento.second) != elemento.second)
+            return -1;
+    }
+
+    return i;
+}
+
+/**
+ * @brief Remove a variável que é folga implícita da restrição i. O seu custo é transferido para as demais variáveis da restrição
+ * e a igualdade passa a ser uma desigualdade
+ *
+ */
+
+static void removeFolgaImplicita(ModeloPresolve &modelo, int j, int i)
+{
+    OperacaoPostsolve operacao;
+    double a = 0;
+
+    for (auto &elemento : modelo.linhas[i])
+    {
+        if (elemento.first == j)
+            a = elemento.second;
+    }
+
+    operacao.tipo = TipoReducao::FOLGA_IMPLICITA;
+    operacao.linha = i;
+    operacao.coluna = j;
+    operacao.valor = modelo.b[i];
+    operacao.coeficiente = a;
+
+    for (auto &elemento : modelo.linhas[i]) // x_j = (b_i - a_ik x_k) / a, então c_j x_j = c_j b_i / a - (c_j a_ik / a) x_k
+    {
+        if (!modelo.colunaAtiva[elemento.first] || elemento.first == j)
+            continue;
+
+        operacao.indices.push_back(elemento.first);
+        operacao.coeficientes.push_back(elemento.second);
+        modelo.c[elemento.first] -= modelo.c[j] * elemento.second / a;
+    }
+
+    modelo.reducao->constanteObjetivo += modelo.c[j] * modelo.b[i] / a;
+    modelo.reducao->operacoes.push_back(operacao);
+
+    modelo.colunaAtiva[j] = false;
+    modelo.tamanhoLinha[i]--;
+    modelo.sentido[i] = a > 0 ? SentidoRestricao::MENOR_IGUAL : SentidoRestricao::MAIOR_IGUAL;
+    modelo.folga[i] = j;
+}
+
+/**
+ * @brief Percorre as variáveis ativas, aplicando as reduções de colunas fixas, vazias, dominadas e de folgas implícitas
+ *
+ * @return true Se houve redução
+ */
+
+static bool reduzColunas(ModeloPresolve &modelo)
+{
+    bool houveReducao = false;
+
+    for (int j = 0 ; j < modelo.numColunas ; j++)
+    {
+        if (!modelo.colunaAtiva[j])
+            continue;
+
+        if (modelo.u[j] == 0) // Variável fixa
+        {
+            fixaColuna(modelo, j, 0);
+            houveReducao = true;
+            continue;
+        }
+
+        /* Diminuir a variável não viola uma restrição se ela tem coeficiente positivo nas de menor ou igual e negativo nas de maior ou igual */
+
+        bool podeDiminuir = true;
+        bool podeAumentar = true;
+
+        for (auto &elemento : modelo.colunas[j])
+        {
+            int i = elemento.first;
+
+            if (!modelo.linhaAtiva[i])
+                continue;
+
+            if (modelo.sentido[i] == SentidoRestricao::IGUALDADE)
+                podeDiminuir = podeAumentar = false;
+            else if ((modelo.sentido[i] == SentidoRestricao::MENOR_IGUAL) == (elemento.second > 0))
+                podeAumentar = false;
+            else
+                podeDiminuir = false;
+        }
+
+        double custo = custoInterno(modelo, j);
+
+        if (podeDiminuir && custo >= 0) // Dominada: o limite inferior é ótimo
+        {
+            fixaColuna(modelo, j, 0);
+            houveReducao = true;
+        }
+
+        else if (podeAumentar && custo <= 0 && modelo.u[j] != INFINITO && std::floor(modelo.u[j]) == modelo.u[j]) // O limite superior é ótimo e inteiro
+        {
+            fixaColuna(modelo, j, modelo.u[j]);
+            houveReducao = true;
+        }
+
+        else
+        {
+            int i = linhaFolgaImplicita(modelo, j);
+
+            if (i != -1)
+            {
+                removeFolgaImplicita(modelo, j, i);
+                houveReducao = true;
+            }
+        }
+    }
+
+    return houveReducao;
+}
+
+/**
+ * @brief Intervalo [inferior, superior] da atividade a_i x permitido pela restrição
+ *
+ */
+
+static void intervaloRestricao(const ModeloPresolve &modelo, int i, double &inferior, double &superior)
+{
+    inferior = modelo.sentido[i] == SentidoRestricao::MENOR_IGUAL ? -INFINITO : modelo.b[i];
+    superior = modelo.sentido[i] == SentidoRestricao::MAIOR_IGUAL ? INFINITO : modelo.b[i];
+}
+
+/**
+ * @brief Une a restrição k à restrição i quando a_k = lambda a_i, se a interseção dos intervalos puder ser escrita como uma única restrição
+ *
+ * @return true Se a restrição k foi removida
+ */
+
+static bool uneRestricoesDuplicadas(ModeloPresolve &modelo, int i, int k, double lambda)
+{
+    double inferior, superior, inferiorK, superiorK;
+
+    intervaloRestricao(modelo, i, inferior, superior);
+    intervaloRestricao(modelo, k, inferiorK, superiorK);
+
+    inferiorK /= lambda; // Intervalo de a_i x imposto pela restrição k
+    superiorK /= lambda;
+
+    if (lambda < 0)
+        std::swap(inferiorK, superiorK);
+
+    inferior = std::max(inferior, inferiorK);
+    superior = std::min(superior, superiorK);
+
+    double tol = tolerancia(std::isinf(inferior) ? superior : inferior);
+
+    if (inferior > superior + tol)
+    {
+        modelo.reducao->semSolucao = true;
+        return false;
+    }
+
+    int basica = modelo.folga[k] != -1 ? modelo.folga[k] : modelo.folga[i]; // Na união em uma igualdade, a folga de i fica básica com valor nulo
+
+    if (superior - inferior <= tol)
+    {
+        modelo.sentido[i] = SentidoRestricao::IGUALDADE;
+        modelo.b[i] = std::isinf(inferior) ? superior : inferior;
+        modelo.folga[i] = -1;
+    }
+
+    else if (std::isinf(inferior))
+        modelo.b[i] = superior;
+
+    else if (std::isinf(superior))
+        modelo.b[i] = inferior;
+
+    else
+        return false; // A interseção é um intervalo, e as duas restrições são necessárias
+
+    removeLinha(modelo, k, basica);
+
+    return true;
+}
+
+/**
+ * @brief Procura restrições com coeficientes proporcionais, agrupadas pelos coeficientes normalizados pelo primeiro elemento
+ *
+ * @return true Se houve redução
+ */
+
+static bool reduzLinhasDuplicadas(ModeloPresolve &modelo)
+{
+    std::map< std::vector<long long>, std::vector<int> > grupos; // Chave: colunas e coeficientes normalizados
+    std::vector< std::vector< std::pair<int, double> > > ativas(modelo.numLinhas); // Elementos ativos de cada restrição, ordenados por coluna
+    bool houveReducao = false;
+
+    for (int i = 0 ; i < modelo.numLinhas ; i++)
+    {
+        if (!modelo.linhaAtiva[i] || modelo.tamanhoLinha[i] < 2)
+            continue;
+
+        for (auto &elemento : modelo.linhas[i])
+        {
+            if (modelo.colunaAtiva[elemento.first])
+                ativas[i].push_back(elemento);
+        }
+
+        std::sort(ativas[i].begin(), ativas[i].end());
+
+        std::vector<long long> chave;
+
+        for (auto &elemento : ativas[i])
+        {
+            chave.push_back(elemento.first);
+            chave.push_back(std::llround(elemento.second / ativas[i][0].second * ESCALA_CHAVE));
+        }
+
+        grupos[chave].push_back(i);
+    }
+
+    for (auto &grupo : grupos)
+    {
+        std::vector<int> &linhas = grupo.second;
+
+        for (int p = 0 ; p < (int) linhas.size() ; p++)
+        {
+            int i = linhas[p];
+
+            for (int q = p + 1 ; q < (int) linhas.size() && modelo.linhaAtiva[i] && !modelo.reducao->semSolucao ; q++)
+            {
+                int k = linhas[q];
+
+                if (!modelo.linhaAtiva[k])
+                    continue;
+
+                double lambda = ativas[k][0].second / ativas[i][0].second;
+                bool proporcionais = true;
+
+                for (int e = 0 ; e < (int) ativas[i].size() && proporcionais ; e++) // Confirma a proporção, já que a chave é arredondada
+                    proporcionais = std::fabs(ativas[k][e].second - lambda * ativas[i][e].second) <= tolerancia(ativas[k][e].second);
+
+                if (proporcionais && uneRestricoesDuplicadas(modelo, i, k, lambda))
+                    houveReducao = true;
+            }
+        }
+    }
+
+    return houveReducao;
+}
+
+/**
+ * @brief Aplica um limite superior implícito à variável. Um limite negativo prova a inviabilidade, um nulo fixa a variável,
+ * e os demais substituem o limite atual apenas se o Simplex aceitar limites, pois as restrições removidas por redundância podem depender deles.
+ *
+ * @return true Se houve redução
+ */
+
+static bool aplicaLimiteImplicito(ModeloPresolve &modelo, int j, double limite)
+{
+    double tol = tolerancia(limite);
+
+    if (limite < -tol)
+    {
+        modelo.reducao->semSolucao = true;
+        return true;
+    }
+
+    if (limite <= tol)
+    {
+        fixaColuna(modelo, j, 0);
+        return true;
+    }
+
+    if (modelo.aceitaLimites && limite < modelo.u[j] - MELHORA_MINIMA_LIMITE * (1 + limite))
+    {
+        modelo.u[j] = limite;
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Aperta os limites superiores das variáveis pelas atividades das restrições. Em a_i x <= b_i, uma variável com a_ij > 0
+ * satisfaz x_j <= (b_i - atividade mínima) / a_ij, e em a_i x >= b_i, uma com a_ij < 0 satisfaz x_j <= (atividade máxima - b_i) / -a_ij.
+ *
+ * @return true Se houve redução
+ */
+
+static bool apertaLimites(ModeloPresolve &modelo)
+{
+    bool houveReducao = false;
+
+    for (int i = 0 ; i < modelo.numLinhas && !modelo.reducao->semSolucao ; i++)
+    {
+        if (!modelo.linhaAtiva[i] || modelo.tamanhoLinha[i] < 2)
+            continue;
+
+        double minima, maxima;
+
+        calculaAtividade(modelo, i, minima, maxima);
+
+        bool temMenor = modelo.sentido[i] != SentidoRestricao::MAIOR_IGUAL && !std::isinf(minima);
+        bool temMaior = modelo.sentido[i] != SentidoRestricao::MENOR_IGUAL && !std::isinf(maxima);
+
+        for (auto &elemento : modelo.linhas[i])
+        {
+            int j = elemento.first;
+            double a = elemento.second;
+
+            if (!modelo.colunaAtiva[j] || modelo.reducao->semSolucao)
+                continue;
+
+            if (temMenor && a > 0)
+                houveReducao = aplicaLimiteImplicito(modelo, j, (modelo.b[i] - minima) / a) || houveReducao;
+
+            else if (temMaior && a < 0)
+                houveReducao = aplicaLimiteImplicito(modelo, j, (maxima - modelo.b[i]) / -a) || houveReducao;
+        }
+    }
+
+    return houveReducao;
+}
+
+/**
+ * @brief Monta o modelo a partir da forma padrão. Cada coluna de folga deve ter um único coeficiente 1 ou -1 e custo nulo,
+ * com no máximo uma folga por restrição.
+ *
+ * @return true Se a estrutura foi reconhecida
+ */
+
+static bool montaModelo(ModeloPresolve &modelo, const MatrizEsparsa &a, const std::vector<double> &b, const std::vector<double> &c,
+                        int numVars, const std::vector<double> &limites)
+{
+    modelo.numLinhas = a.getLinhas();
+    modelo.numColunas = numVars;
+    modelo.linhas.assign(modelo.numLinhas, {});
+    modelo.colunas.assign(numVars, {});
+    modelo.sentido.assign(modelo.numLinhas, SentidoRestricao::IGUALDADE);
+    modelo.folga.assign(modelo.numLinhas, -1);
+    modelo.b = b;
+    modelo.c.assign(c.begin(), c.begin() + numVars);
+    modelo.u = limites;
+
+    for (int j = numVars ; j < a.getColunas() ; j++)
+    {
+        if (a.fimColuna(j) - a.inicioColuna(j) != 1 || c[j] != 0)
+            return false;
+
+        int p = a.inicioColuna(j);
+        int i = a.linhaElemento(p);
+
+        if (std::fabs(a.valorElemento(p)) != 1 || modelo.folga[i] != -1)
+            return false;
+
+        modelo.folga[i] = j;
+        modelo.sentido[i] = a.valorElemento(p) > 0 ? SentidoRestricao::MENOR_IGUAL : SentidoRestricao::MAIOR_IGUAL;
+    }
+
+    for (int j = 0 ; j < numVars ; j++)
+    {
+        for (int p = a.inicioColuna(j) ; p < a.fimColuna(j) ; p++)
+        {
+            modelo.linhas[a.linhaElemento(p)].push_back( {j, a.valorElemento(p)} );
+            modelo.colunas[j].push_back( {a.linhaElemento(p), a.valorElemento(p)} );
+        }
+    }
+
+    modelo.linhaAtiva.assign(modelo.numLinhas, true);
+    modelo.colunaAtiva.assign(numVars, true);
+    modelo.tamanhoLinha.resize(modelo.numLinhas);
+    modelo.tamanhoColuna.resize(numVars);
+
+    for (int i = 0 ; i < modelo.numLinhas ; i++)
+        modelo.tamanhoLinha[i] = modelo.linhas[i].size();
+
+    for (int j = 0 ; j < numVars ; j++)
+        modelo.tamanhoColuna[j] = modelo.colunas[j].size();
+
+    return true;
+}
+
+/**
+ * @brief Monta o problema reduzido na forma padrão: as variáveis mantidas, na ordem original, seguidas de uma folga por desigualdade mantida
+ *
+ */
+
+static void montaProblemaReduzido(const ModeloPresolve &modelo, MatrizEsparsa &a, std::vector<double> &b, std::vector<double> &c,
+                                    int &numVars, std::vector<double> &limites)
+{
+    ReducaoPresolve &reducao = *modelo.reducao;
+    std::vector<int> novaColuna(modelo.numColunas, -1);
+    std::vector<ElementoEsparso> elementos;
+    std::vector<double> sinais; // Sinal de cada restrição mantida, -1 se ela foi multiplicada por -1
+
+    reducao.linhasMantidas.clear();
+    reducao.colunasMantidas.clear();
+    b.clear();
+    c.clear();
+    limites.clear();
+
+    for (int j = 0 ; j < modelo.numColunas ; j++)
+    {
+        if (!modelo.colunaAtiva[j])
+            continue;
+
+        novaColuna[j] = reducao.colunasMantidas.size();
+        reducao.colunasMantidas.push_back(j);
+        c.push_back(modelo.c[j]);
+        limites.push_back(modelo.u[j]);
+    }
+
+    numVars = reducao.colunasMantidas.size();
+
+    for (int i = 0 ; i < modelo.numLinhas ; i++)
+    {
+        if (!modelo.linhaAtiva[i])
+            continue;
+
+        int linha = reducao.linhasMantidas.size();
+        double sinal = modelo.b[i] < 0 ? -1 : 1; // As variáveis fixadas podem tornar o lado direito negativo, e o Simplex parte de B >= 0
+
+        reducao.linhasMantidas.push_back(i);
+        b.push_back(sinal * modelo.b[i]);
+        sinais.push_back(sinal);
+
+        for (auto &elemento : modelo.linhas[i])
+        {
+            if (modelo.colunaAtiva[elemento.first])
+                elementos.push_back( {linha, novaColuna[elemento.first], sinal * elemento.second} );
+        }
+    }
+
+    for (int linha = 0 ; linha < (int) reducao.linhasMantidas.size() ; linha++) // As folgas seguem a ordem das restrições, como na entrada
+    {
+        int i = reducao.linhasMantidas[linha];
+
+        if (modelo.sentido[i] == SentidoRestricao::IGUALDADE)
+            continue;
+
+        elementos.push_back( {linha, (int) reducao.colunasMantidas.size(), modelo.sentido[i] == SentidoRestricao::MENOR_IGUAL ? sinais[linha] : -sinais[linha]} );
+        reducao.colunasMantidas.push_back(modelo.folga[i]);
+        c.push_back(0);
+    }
+
+    a = MatrizEsparsa(reducao.linhasMantidas.size(), reducao.colunasMantidas.size(), elementos);
+}
+
+ReducaoPresolve realizaPresolve(MatrizEsparsa &a, std::vector<double> &b, std::vector<double> &c, int &numVars, std::vector<double> &limites,
+                                bool tipoProblema, bool aceitaLimites)
+{
+    ReducaoPresolve reducao;
+    ModeloPresolve modelo;
+
+    modelo.tipoProblema = tipoProblema;
+    modelo.aceitaLimites = aceitaLimites;
+    modelo.reducao = &reducao;
+
+    if (!montaModelo(modelo, a, b, c, numVars, limites))
+        return reducao;
+
+    reducao.aplicado = true;
+    reducao.linhasOriginais = a.getLinhas();
+    reducao.colunasOriginais = a.getColunas();
+    reducao.numVarsOriginal = numVars;
+    reducao.aOriginal = a;
+    reducao.bOriginal = b;
+
+    bool houveReducao = true;
+
+    for (int passada = 0 ; passada < MAXIMO_PASSADAS && houveReducao && !reducao.semSolucao ; passada++)
+    {
+        houveReducao = reduzLinhas(modelo);
+
+        if (!reducao.semSolucao)
+            houveReducao = reduzColunas(modelo) || houveReducao;
+
+        if (!reducao.semSolucao)
+            houveReducao = reduzLinhasDuplicadas(modelo) || houveReducao;
+
+        if (!reducao.semSolucao)
+            houveReducao = apertaLimites(modelo) || houveReducao;
+    }
+
+    if (!reducao.semSolucao)
+        montaProblemaReduzido(modelo, a, b, c, numVars, limites);
+
+    return reducao;
+}
+
+std::vector<double> realizaPostsolve(const ReducaoPresolve &reducao, const std::vector<double> &valores, const std::vector<int> &basicas,
+                                        std::vector<int> &basicasOriginais)
+{
+    std::vector<double> x(reducao.colunasOriginais, 0);
+
+    for (int k = 0 ; k < (int) valores.size() && k < (int) reducao.colunasMantidas.size() ; k++)
+        x[reducao.colunasMantidas[k]] = valores[k];
+
+    for (auto operacao = reducao.operacoes.rbegin() ; operacao != reducao.operacoes.rend() ; operacao++) // As variáveis da operação já têm valor
+    {
+        if (operacao->tipo == TipoReducao::FIXA_COLUNA)
+            x[operacao->coluna] = operacao->valor;
+
+        else if (operacao->tipo == TipoReducao::FOLGA_IMPLICITA)
+        {
+            double soma = operacao->valor;
+
+            for (int e = 0 ; e < (int) operacao->indices.size() ; e++)
+                soma -= operacao->coeficientes[e] * x[operacao->indices[e]];
+
+            x[operacao->coluna] = soma / operacao->coeficiente;
+        }
+    }
+
+    std::vector<double> atividade(reducao.linhasOriginais, 0);
+
+    for (int j = 0 ; j < reducao.numVarsOriginal ; j++)
+    {
+        for (int p = reducao.aOriginal.inicioColuna(j) ; p < reducao.aOriginal.fimColuna(j) ; p++)
+            atividade[reducao.aOriginal.linhaElemento(p)] += reducao.aOriginal.valorElemento(p) * x[j];
+    }
+
+    for (int j = reducao.numVarsOriginal ; j < reducao.colunasOriginais ; j++) // Folga = (b_i - a_i x) / coeficiente
+    {
+        int p = reducao.aOriginal.inicioColuna(j);
+        int i = reducao.aOriginal.linhaElemento(p);
+
+        x[j] = (reducao.bOriginal[i] - atividade[i]) / reducao.aOriginal.valorElemento(p);
+    }
+
+    for (double &valor : x) // Resíduos de arredondamento das substituições
+    {
+        if (std::fabs(valor) < TOLERANCIA_PRESOLVE)
+            valor = 0;
+    }
+
+    basicasOriginais.clear();
+
+    for (int k : basicas)
+    {
+        if (k >= 0 && k < (int) reducao.colunasMantidas.size()) // As variáveis artificiais não existem no problema original
+            basicasOriginais.push_back(reducao.colunasMantidas[k]);
+    }
+
+    for (auto &operacao : reducao.operacoes)
+    {
+        if (operacao.tipo == TipoReducao::REMOVE_LINHA && operacao.coluna != -1
+                && std::find(basicasOriginais.begin(), basicasOriginais.end(), operacao.coluna) == basicasOriginais.end())
+            basicasOriginais.push_back(operacao.coluna);
+    }
+
+    return x;
+}
@@ -0,0 +1,99 @@
+#ifndef PRESOLVE_H
+#define PRESOLVE_H
+
+/**
+ * @file presolve.hpp
+ * @brief Declaração do presolve, que reduz o problema de programação linear antes da criação do Simplex, e do postsolve,
+ * que leva a solução e a base do problema reduzido de volta ao problema original.
+ *
+ */
+
+#include <vector>
+
+#include "matriz_esparsa.hpp"
+
+/**
+ * @brief Tipos de redução guardados para o postsolve.
+ *
+ */
+
+enum class TipoReducao
+{
+    FIXA_COLUNA, // A variável foi fixada em um valor e removida do problema
+    REMOVE_LINHA, // A restrição foi removida por ser vazia, redundante, forçante, duplicada ou apenas um limite de uma variável
+    FOLGA_IMPLICITA // A variável aparecia apenas em uma igualdade e passou a ser a folga dela, que virou uma desigualdade
+};
+
+/**
+ * @brief Uma redução aplicada pelo presolve. Os índices são os do problema original.
+ *
+ */
+
+typedef struct
+{
+    TipoReducao tipo; // O tipo da redução
+    int linha; // A restrição envolvida, ou -1
+    int coluna; // A variável fixada ou a folga implícita. Na remoção de restrição, a variável que fica básica nela, ou -1
+    double valor; // O valor da variável fixada, ou o lado direito da igualdade da folga implícita
+    double coeficiente; // O coeficiente da folga implícita na igualdade
+    std::vector<int> indices; // As demais variáveis da igualdade no momento da redução
+    std::vector<double> coeficientes; // Os coeficientes dessas variáveis
+} OperacaoPostsolve;
+
+/**
+ * @brief Contém o resultado do presolve e os dados necessários para o postsolve.
+ *
+ */
+
+typedef struct
+{
+    bool aplicado = false; // Indica se o presolve foi aplicado. As colunas de folga devem ter um único coeficiente 1 ou -1 e custo nulo
+    bool semSolucao = false; // Indica se o presolve provou que o problema não possui solução
+    int linhasOriginais = 0; // Número de restrições do problema original
+    int colunasOriginais = 0; // Número de coeficientes do problema original, incluindo as folgas
+    int numVarsOriginal = 0; // Número de variáveis na forma canônica do problema original
+    std::vector<int> linhasMantidas; // Restrição original de cada restrição do problema reduzido
+    std::vector<int> colunasMantidas; // Variável original de cada coluna do problema reduzido, incluindo as folgas
+    std::vector<OperacaoPostsolve> operacoes; // Reduções na ordem em que foram aplicadas
+    double constanteObjetivo = 0; // Contribuição das variáveis removidas para a função objetivo, com os coeficientes como fornecidos
+    MatrizEsparsa aOriginal; // Coeficientes do problema original, para o cálculo das folgas no postsolve
+    std::vector<double> bOriginal; // Vetor B do problema original
+} ReducaoPresolve;
+
+/**
+ * @brief Reduz o problema antes da criação do Simplex. As reduções são repetidas até que nenhuma se aplique:
+ * colunas fixas e vazias, restrições vazias, restrições com uma variável, restrições forçantes e redundantes pela atividade mínima e máxima,
+ * restrições duplicadas, colunas dominadas, colunas com um único coeficiente em uma igualdade (folgas implícitas) e aperto de limites.
+ *
+ * Como a integralidade das variáveis só é conhecida após a resolução, as reduções preservam também as soluções inteiras: as variáveis
+ * removidas são fixadas em valores impostos pelas restrições ou em limites inteiros, e uma folga implícita exige coeficiente unitário
+ * e os demais coeficientes e o lado direito inteiros.
+ *
+ * @param a A matriz de coeficientes na forma padrão, substituída pela reduzida
+ * @param b O vetor de soluções das restrições, substituído pelo reduzido
+ * @param c O vetor de coeficientes da função objetivo, substituído pelo reduzido
+ * @param numVars O número de variáveis na forma canônica, substituído pelo do problema reduzido
+ * @param limites O limite superior de cada variável da forma canônica, substituído pelos do problema reduzido
+ * @param tipoProblema true se é de maximização, false se é de minimização
+ * @param aceitaLimites Indica se o método aceita limites nas variáveis. Se sim, restrições com uma variável e limites implícitos mais justos viram limites superiores
+ * @return ReducaoPresolve O resultado, com os dados para o postsolve. Se não foi aplicado, o problema não é alterado
+ */
+
+ReducaoPresolve realizaPresolve(MatrizEsparsa &a, std::vector<double> &b, std::vector<double> &c, int &numVars, std::vector<double> &limites,
+                                bool tipoProblema, bool aceitaLimites);
+
+/**
+ * @brief Leva a solução e a base do problema reduzido ao problema original, desfazendo as reduções na ordem inversa.
+ * As folgas originais são recalculadas a partir das restrições originais.
+ *
+ * @param reducao O resultado do presolve
+ * @param valores Os valores das colunas do problema reduzido. Pode conter apenas as variáveis da forma canônica
+ * @param basicas As colunas básicas do problema reduzido
+ * @param basicasOriginais As variáveis básicas no problema original: as correspondentes às básicas do reduzido e as que ficam básicas nas restrições removidas
+ * @return std::vector<double> Os valores de todas as variáveis do problema original, incluindo as folgas
+ */
+
+std::vector<double> realizaPostsolve(const ReducaoPresolve &reducao, const std::vector<double> &valores, const std::vector<int> &basicas,
+                                        std::vector<int> &basicasOriginais);
+
+#endif
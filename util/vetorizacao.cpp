@@ -0,0 +1,550 @@
+#include <limits>
+
+#include "vetorizacao.hpp"
+
+/**
+ * @file vetorizacao.cpp
+ * @brief Implementa os núcleos vetorizados e a escolha, em tempo de execução, da versão adequada ao processador.
+ *
+ * As versões SIMD são compiladas com o atributo target, sem exigir flags globais de compilação.
+ * Assim, o mesmo executável funciona em qualquer processador x86-64 e usa o melhor conjunto disponível.
+ * O arquivo deve ser compilado com -ffp-contract=off, pois o alvo AVX-512 permite ao compilador fundir a multiplicação
+ * e a subtração em FMA, o que alteraria os arredondamentos em relação à versão escalar.
+ *
+ * As buscas pelo menor elemento mantêm, em cada faixa do registrador, o menor valor e o maior índice em que ele ocorreu.
+ * Ao final, as faixas são combinadas escolhendo o menor valor e, entre os empatados, o maior índice.
+ * Isso reproduz exatamente a busca escalar com <=, que retorna a última ocorrência do mínimo.
+ */
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define VETORIZACAO_X86
+#endif
+
+/**
+ * @brief Tabela com as versões dos núcleos em uso
+ *
+ */
+
+typedef struct
+{
+    void (*subtraiMultiplo)(double *destino, const double *origem, double multiplicador, int n);
+    void (*divideVetor)(double *v, double divisor, int n);
+    int (*indiceMenor)(const double *v, int n);
+    int (*indiceMenorRazao)(const double *b, const double *coluna, int n);
+    ConjuntoInstrucoes conjunto;
+} Nucleos;
+
+/* Versões escalares. Servem de referência e também tratam o final dos vetores nas versões SIMD. */
+
+static void subtraiMultiploEscalar(double *destino, const double *origem, double multiplicador, int n)
+{
+    for (int k = 0 ; k < n ; k++)
+        destino[k] = destino[k] - (multiplicador * origem[k]);
+}
+
+static void divideVetorEscalar(double *v, double divisor, int n)
+{
+    for (int k = 0 ; k < n ; k++)
+        v[k] = v[k] / divisor;
+}
+
+/**
+ * @brief Continua a busca pelo menor elemento a partir de um índice, com o menor valor e seu índice já encontrados.
+ *
+ */
+
+static int continuaIndiceMenor(const double *v, int inicio, int n, double menor, int localizacao)
+{
+    for (int i = inicio ; i < n ; i++)
+    {
+        if (v[i] <= menor)
+        {
+            menor = v[i];
+            localizacao = i;
+        }
+    }
+
+    return localizacao;
+}
+
+static int indiceMenorEscalar(const double *v, int n)
+{
+    return continuaIndiceMenor(v, 1, n, v[0], 0);
+}
+
+/**
+ * @brief Continua o teste da razão a partir de um índice, com a menor razão e seu índice já encontrados.
+ *
+ */
+
+static int continuaIndiceMenorRazao(const double *b, const double *coluna, int inicio, int n, double minimo, int localizacao, bool existePositivo)
+{
+    for (int i = inicio ; i < n ; i++)
+    {
+        if (coluna[i] > 0) // Apenas linhas com coeficientes positivos na coluna pivô participam
+        {
+            existePositivo = true;
+
+            if (b[i] / coluna[i] <= minimo)
+            {
+                minimo = b[i] / coluna[i];
+                localizacao = i;
+            }
+        }
+    }
+
+    if (!existePositivo)
+        return -1;
+
+    return localizacao < 0 ? 0 : localizacao;
+}
+
+static int indiceMenorRazaoEscalar(const double *b, const double *coluna, int n)
+{
+    return continuaIndiceMenorRazao(b, coluna, 0, n, std::numeric_limits<double>::max(), -1, false);
+}
+
+#ifdef VETORIZACAO_X86
+
+/**
+ * @brief Combina as faixas de um registrador: retorna o menor valor e o maior índice entre as faixas que o contêm.
+ *
+ */
+
+static void combinaFaixas(const double *valores, const double *indices, int faixas, double &menor, int &localizacao)
+{
+    for (int f = 0 ; f < faixas ; f++)
+    {
+        if (indices[f] < 0)
+            continue;
+
+        if (localizacao < 0 || valores[f] < menor || (valores[f] == menor && (int) indices[f] > localizacao))
+        {
+            menor = valores[f];
+            localizacao = (int) indices[f];
+        }
+    }
+}
+
+/* Versões SSE2 */
+
+__attribute__((target("sse2")))
+static void subtraiMultiploSSE2(double *destino, const double *origem, double multiplicador, int n)
+{
+    __m128d m = _mm_set1_pd(multiplicador);
+    int k = 0;
+
+    for ( ; k + 2 <= n ; k += 2)
+        _mm_storeu_pd(destino + k, _mm_sub_pd(_mm_loadu_pd(destino + k), _mm_mul_pd(m, _mm_loadu_pd(origem + k))));
+
+    subtraiMultiploEscalar(destino + k, origem + k, multiplicador, n - k);
+}
+
+__attribute__((target("sse2")))
+static void divideVetorSSE2(double *v, double divisor, int n)
+{
+    __m128d d = _mm_set1_pd(divisor);
+    int k = 0;
+
+    for ( ; k + 2 <= n ; k += 2)
+        _mm_storeu_pd(v + k, _mm_div_pd(_mm_loadu_pd(v + k), d));
+
+    divideVetorEscalar(v + k, divisor, n - k);
+}
+
+__attribute__((target("sse2")))
+static int indiceMenorSSE2(const double *v, int n)
+{
+    __m128d menores = _mm_set1_pd(std::numeric_limits<double>::infinity());
+    __m128d indices = _mm_set1_pd(-1);
+    __m128d atuais = _mm_setr_pd(0, 1);
+    __m128d passo = _mm_set1_pd(2);
+    int k = 0;
+
+    for ( ; k + 2 <= n ; k += 2)
+    {
+        __m128d x = _mm_loadu_pd(v + k);
+        __m128d mascara = _mm_cmple_pd(x, menores);
+
+        menores = _mm_or_pd(_mm_and_pd(mascara, x), _mm_andnot_pd(mascara, menores));
+        indices = _mm_or_pd(_mm_and_pd(mascara, atuais), _mm_andnot_pd(mascara, indices));
+        atuais = _mm_add_pd(atuais, passo);
+    }
+
+    double valoresFaixas[2], indicesFaixas[2];
+    double menor = 0;
+    int localizacao = -1;
+
+    _mm_storeu_pd(valoresFaixas, menores);
+    _mm_storeu_pd(indicesFaixas, indices);
+    combinaFaixas(valoresFaixas, indicesFaixas, 2, menor, localizacao);
+
+    if (localizacao < 0)
+        return indiceMenorEscalar(v, n);
+
+    return continuaIndiceMenor(v, k, n, menor, localizacao);
+}
+
+__attribute__((target("sse2")))
+static int indiceMenorRazaoSSE2(const double *b, const double *coluna, int n)
+{
+    __m128d zero = _mm_setzero_pd();
+    __m128d infinito = _mm_set1_pd(std::numeric_limits<double>::infinity());
+    __m128d menores = _mm_set1_pd(std::numeric_limits<double>::max());
+    __m128d indices = _mm_set1_pd(-1);
+    __m128d atuais = _mm_setr_pd(0, 1);
+    __m128d passo = _mm_set1_pd(2);
+    __m128d positivos = zero;
+    int k = 0;
+
+    for ( ; k + 2 <= n ; k += 2)
+    {
+        __m128d c = _mm_loadu_pd(coluna + k);
+        __m128d ePositivo = _mm_cmpgt_pd(c, zero);
+        __m128d razao = _mm_div_pd(_mm_loadu_pd(b + k), c);
+
+        razao = _mm_or_pd(_mm_and_pd(ePositivo, razao), _mm_andnot_pd(ePositivo, infinito)); // Coeficientes não positivos não participam
+
+        __m128d mascara = _mm_cmple_pd(razao, menores);
+
+        menores = _mm_or_pd(_mm_and_pd(mascara, razao), _mm_andnot_pd(mascara, menores));
+        indices = _mm_or_pd(_mm_and_pd(mascara, atuais), _mm_andnot_pd(mascara, indices));
+        positivos = _mm_or_pd(positivos, ePositivo);
+        atuais = _mm_add_pd(atuais, passo);
+    }
+
+    double valoresFaixas[2], indicesFaixas[2];
+    double minimo = std::numeric_limits<double>::max();
+    int localizacao = -1;
+
+    _mm_storeu_pd(valoresFaixas, menores);
+    _mm_storeu_pd(indicesFaixas, indices);
+    combinaFaixas(valoresFaixas, indicesFaixas, 2, minimo, localizacao);
+
+    return continuaIndiceMenorRazao(b, coluna, k, n, minimo, localizacao, _mm_movemask_pd(positivos) != 0);
+}
+
+/* Versões AVX2 */
+
+__attribute__((target("avx2")))
+static void subtraiMultiploAVX2(double *destino, const double *origem, double multiplicador, int n)
+{
+    __m256d m = _mm256_set1_pd(multiplicador);
+    int k = 0;
+
+    for ( ; k + 8 <= n ; k += 8) // Duas operações independentes por iteração para ocultar a latência
+    {
+        __m256d d0 = _mm256_sub_pd(_mm256_loadu_pd(destino + k), _mm256_mul_pd(m, _mm256_loadu_pd(origem + k)));
+        __m256d d1 = _mm256_sub_pd(_mm256_loadu_pd(destino + k + 4), _mm256_mul_pd(m, _mm256_loadu_pd(origem + k + 4)));
+
+        _mm256_storeu_pd(destino + k, d0);
+        _mm256_storeu_pd(destino + k + 4, d1);
+    }
+
+    for ( ; k + 4 <= n ; k += 4)
+        _mm256_storeu_pd(destino + k, _mm256_sub_pd(_mm256_loadu_pd(destino + k), _mm256_mul_pd(m, _mm256_loadu_pd(origem + k))));
+
+    subtraiMultiploEscalar(destino + k, origem + k, multiplicador, n - k);
+}
+
+__attribute__((target("avx2")))
+static void divideVetorAVX2(double *v, double divisor, int n)
+{
+    __m256d d = _mm256_set1_pd(divisor);
+    int k = 0;
+
+    for ( ; k + 4 <= n ; k += 4)
+        _mm256_storeu_pd(v + k, _mm256_div_pd(_mm256_loadu_pd(v + k), d));
+
+    divideVetorEscalar(v + k, divisor, n - k);
+}
+
+__attribute__((target("avx2")))
+static int indiceMenorAVX2(const double *v, int n)
+{
+    __m256d menores = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+    __m256d indices = _mm256_set1_pd(-1);
+    __m256d atuais = _mm256_setr_pd(0, 1, 2, 3);
+    __m256d passo = _mm256_set1_pd(4);
+    int k = 0;
+
+    for ( ; k + 4 <= n ; k += 4)
+    {
+        __m256d x = _mm256_loadu_pd(v + k);
+        __m256d mascara = _mm256_cmp_pd(x, menores, _CMP_LE_OQ);
+
+        menores = _mm256_blendv_pd(menores, x, mascara);
+        indices = _mm256_blendv_pd(indices, atuais, mascara);
+        atuais = _mm256_add_pd(atuais, passo);
+    }
+
+    double valoresFaixas[4], indicesFaixas[4];
+    double menor = 0;
+    int localizacao = -1;
+
+    _mm256_storeu_pd(valoresFaixas, menores);
+    _mm256_storeu_pd(indicesFaixas, indices);
+    combinaFaixas(valoresFaixas, indicesFaixas, 4, menor, localizacao);
+
+    if (localizacao < 0)
+        return indiceMenorEscalar(v, n);
+
+    return continuaIndiceMenor(v, k, n, menor, localizacao);
+}
+
+__attribute__((target("avx2")))
+static int indiceMenorRazaoAVX2(const double *b, const double *coluna, int n)
+{
+    __m256d zero = _mm256_setzero_pd();
+    __m256d infinito = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+    __m256d menores = _mm256_set1_pd(std::numeric_limits<double>::max());
+    __m256d indices = _mm256_set1_pd(-1);
+    __m256d atuais = _mm256_setr_pd(0, 1, 2, 3);
+    __m256d passo = _mm256_set1_pd(4);
+    __m256d positivos = zero;
+    int k = 0;
+
+    for ( ; k + 4 <= n ; k += 4)
+    {
+        __m256d c = _mm256_loadu_pd(coluna + k);
+        __m256d ePositivo = _mm256_cmp_pd(c, zero, _CMP_GT_OQ);
+        __m256d razao = _mm256_blendv_pd(infinito, _mm256_div_pd(_mm256_loadu_pd(b + k), c), ePositivo);
+        __m256d mascara = _mm256_cmp_pd(razao, menores, _CMP_LE_OQ);
+
+        menores = _mm256_blendv_pd(menores, razao, mascara);
+        indices = _mm256_blendv_pd(indices, atuais, mascara);
+        positivos = _mm256_or_pd(positivos, ePositivo);
+        atuais = _mm256_add_pd(atuais, passo);
+    }
+
+    double valoresFaixas[4], indicesFaixas[4];
+    double minimo = std::numeric_limits<double>::max();
+    int localizacao = -1;
+
+    _mm256_storeu_pd(valoresFaixas, menores);
+    _mm256_storeu_pd(indicesFaixas, indices);
+    combinaFaixas(valoresFaixas, indicesFaixas, 4, minimo, localizacao);
+
+    return continuaIndiceMenorRazao(b, coluna, k, n, minimo, localizacao, _mm256_movemask_pd(positivos) != 0);
+}
+
+/* Versões AVX-512. O final dos vetores é tratado com cargas mascaradas, sem laço escalar. */
+
+__attribute__((target("avx512f")))
+static void subtraiMultiploAVX512(double *destino, const double *origem, double multiplicador, int n)
+{
+    __m512d m = _mm512_set1_pd(multiplicador);
+    int k = 0;
+
+    for ( ; k + 16 <= n ; k += 16)
+    {
+        __m512d d0 = _mm512_sub_pd(_mm512_loadu_pd(destino + k), _mm512_mul_pd(m, _mm512_loadu_pd(origem + k)));
+        __m512d d1 = _mm512_sub_pd(_mm512_loadu_pd(destino + k + 8), _mm512_mul_pd(m, _mm512_loadu_pd(origem + k + 8)));
+
+        _mm512_storeu_pd(destino + k, d0);
+        _mm512_storeu_pd(destino + k + 8, d1);
+    }
+
+    for ( ; k < n ; k += 8)
+    {
+        __mmask8 resto = n - k >= 8 ? 0xFF : (__mmask8) ((1u << (n - k)) - 1);
+        __m512d d = _mm512_maskz_loadu_pd(resto, destino + k);
+        __m512d o = _mm512_maskz_loadu_pd(resto, origem + k);
+
+        _mm512_mask_storeu_pd(destino + k, resto, _mm512_sub_pd(d, _mm512_mul_pd(m, o)));
+    }
+}
+
+__attribute__((target("avx512f")))
+static void divideVetorAVX512(double *v, double divisor, int n)
+{
+    __m512d d = _mm512_set1_pd(divisor);
+
+    for (int k = 0 ; k < n ; k += 8)
+    {
+        __mmask8 resto = n - k >= 8 ? 0xFF : (__mmask8) ((1u << (n - k)) - 1);
+
+        _mm512_mask_storeu_pd(v + k, resto, _mm512_div_pd(_mm512_maskz_loadu_pd(resto, v + k), d));
+    }
+}
+
+__attribute__((target("avx512f")))
+static int indiceMenorAVX512(const double *v, int n)
+{
+    __m512d menores = _mm512_set1_pd(std::numeric_limits<double>::infinity());
+    __m512d indices = _mm512_set1_pd(-1);
+    __m512d atuais = _mm512_setr_pd(0, 1, 2, 3, 4, 5, 6, 7);
+    __m512d passo = _mm512_set1_pd(8);
+    int k = 0;
+
+    for ( ; k + 8 <= n ; k += 8)
+    {
+        __m512d x = _mm512_loadu_pd(v + k);
+        __mmask8 mascara = _mm512_cmp_pd_mask(x, menores, _CMP_LE_OQ);
+
+        menores = _mm512_mask_blend_pd(mascara, menores, x);
+        indices = _mm512_mask_blend_pd(mascara, indices, atuais);
+        atuais = _mm512_add_pd(atuais, passo);
+    }
+
+    double valoresFaixas[8], indicesFaixas[8];
+    double menor = 0;
+    int localizacao = -1;
+
+    _mm512_storeu_pd(valoresFaixas, menores);
+    _mm512_storeu_pd(indicesFaixas, indices);
+    combinaFaixas(valoresFaixas, indicesFaixas, 8, menor, localizacao);
+
+    if (localizacao < 0)
+        return indiceMenorEscalar(v, n);
+
+    return continuaIndiceMenor(v, k, n, menor, localizacao);
+}
+
+__attribute__((target("avx512f")))
+static int indiceMenorRazaoAVX512(const double *b, const double *coluna, int n)
+{
+    __m512d zero = _mm512_setzero_pd();
+    __m512d infinito = _mm512_set1_pd(std::numeric_limits<double>::infinity());
+    __m512d menores = _mm512_set1_pd(std::numeric_limits<double>::max());
+    __m512d indices = _mm512_set1_pd(-1);
+    __m512d atuais = _mm512_setr_pd(0, 1, 2, 3, 4, 5, 6, 7);
+    __m512d passo = _mm512_set1_pd(8);
+    __mmask8 positivos = 0;
+
+    for (int k = 0 ; k < n ; k += 8)
+    {
+        __mmask8 resto = n - k >= 8 ? 0xFF : (__mmask8) ((1u << (n - k)) - 1);
+        __m512d c = _mm512_maskz_loadu_pd(resto, coluna + k);
+        __mmask8 ePositivo = _mm512_cmp_pd_mask(c, zero, _CMP_GT_OQ); // As posições fora do vetor são nulas e não participam
+        __m512d razao = _mm512_mask_div_pd(infinito, ePositivo, _mm512_maskz_loadu_pd(resto, b + k), c);
+        __mmask8 mascara = _mm512_cmp_pd_mask(razao, menores, _CMP_LE_OQ);
+
+        menores = _mm512_mask_blend_pd(mascara, menores, razao);
+        indices = _mm512_mask_blend_pd(mascara, indices, atuais);
+        positivos |= ePositivo;
+        atuais = _mm512_add_pd(atuais, passo);
+    }
+
+    double valoresFaixas[8], indicesFaixas[8];
+    double minimo = std::numeric_limits<double>::max();
+    int localizacao = -1;
+
+    _mm512_storeu_pd(valoresFaixas, menores);
+    _mm512_storeu_pd(indicesFaixas, indices);
+    combinaFaixas(valoresFaixas, indicesFaixas, 8, minimo, localizacao);
+
+    return continuaIndiceMenorRazao(b, coluna, n, n, minimo, localizacao, positivos != 0);
+}
+
+#endif
+
+/**
+ * @brief Retorna a tabela de núcleos de um conjunto de instruções
+ *
+ * @param conjunto O conjunto desejado
+ * @return Nucleos A tabela correspondente
+ */
+
+static Nucleos retornaNucleos(ConjuntoInstrucoes conjunto)
+{
+    switch (conjunto)
+    {
+#ifdef VETORIZACAO_X86
+        case ConjuntoInstrucoes::AVX512:
+            return {subtraiMultiploAVX512, divideVetorAVX512, indiceMenorAVX512, indiceMenorRazaoAVX512, conjunto};
+        case ConjuntoInstrucoes::AVX2:
+            return {subtraiMultiploAVX2, divideVetorAVX2, indiceMenorAVX2, indiceMenorRazaoAVX2, conjunto};
+        case ConjuntoInstrucoes::SSE2:
+            return {subtraiMultiploSSE2, divideVetorSSE2, indiceMenorSSE2, indiceMenorRazaoSSE2, conjunto};
+#endif
+        default:
+            return {subtraiMultiploEscalar, divideVetorEscalar, indiceMenorEscalar, indiceMenorRazaoEscalar, ConjuntoInstrucoes::ESCALAR};
+    }
+}
+
+/**
+ * @brief Verifica se o processador suporta o conjunto de instruções
+ *
+ * @param conjunto O conjunto a ser verificado
+ * @return true Se é suportado
+ * @return false Caso contrário
+ */
+
+static bool eSuportado(ConjuntoInstrucoes conjunto)
+{
+#ifdef VETORIZACAO_X86
+    __builtin_cpu_init(); // Necessário, pois a função pode ser chamada durante a inicialização estática
+
+    switch (conjunto)
+    {
+        case ConjuntoInstrucoes::AVX512:
+            return __builtin_cpu_supports("avx512f");
+        case ConjuntoInstrucoes::AVX2:
+            return __builtin_cpu_supports("avx2");
+        case ConjuntoInstrucoes::SSE2:
+            return __builtin_cpu_supports("sse2");
+        default:
+            return true;
+    }
+#else
+    return conjunto == ConjuntoInstrucoes::ESCALAR;
+#endif
+}
+
+/**
+ * @brief Escolhe o melhor conjunto de instruções suportado pelo processador
+ *
+ * @return Nucleos A tabela de núcleos do conjunto escolhido
+ */
+
+static Nucleos escolheNucleos()
+{
+    ConjuntoInstrucoes preferencia[] = {ConjuntoInstrucoes::AVX512, ConjuntoInstrucoes::AVX2, ConjuntoInstrucoes::SSE2};
+
+    for (auto conjunto : preferencia)
+    {
+        if (eSuportado(conjunto))
+            return retornaNucleos(conjunto);
+    }
+
+    return retornaNucleos(ConjuntoInstrucoes::ESCALAR);
+}
+
+static Nucleos nucleos = escolheNucleos(); // Núcleos em uso, escolhidos uma única vez na inicialização do programa
+
+void subtraiMultiplo(double *destino, const double *origem, double multiplicador, int n)
+{
+    nucleos.subtraiMultiplo(destino, origem, multiplicador, n);
+}
+
+void divideVetor(double *v, double divisor, int n)
+{
+    nucleos.divideVetor(v, divisor, n);
+}
+
+int indiceMenor(const double *v, int n)
+{
+    return nucleos.indiceMenor(v, n);
+}
+
+int indiceMenorRazao(const double *b, const double *coluna, int n)
+{
+    return nucleos.indiceMenorRazao(b, coluna, n);
+}
+
+bool selecionaConjuntoInstrucoes(ConjuntoInstrucoes conjunto)
+{
+    if (!eSuportado(conjunto))
+        return false;
+
+    nucleos = retornaNucleos(conjunto);
+
+    return true;
+}
+
+ConjuntoInstrucoes retornaConjuntoInstrucoes()
+{
+    return nucleos.conjunto;
+}
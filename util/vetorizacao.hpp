@@ -0,0 +1,87 @@
+#ifndef VETORIZACAO_H
+#define VETORIZACAO_H
+
+/**
+ * @file vetorizacao.hpp
+ * @brief Declaração dos núcleos vetorizados utilizados no pivoteamento e na escolha do pivô do Simplex.
+ *
+ * Cada núcleo possui versões AVX-512, AVX2 e SSE2, além de uma versão escalar para arquiteturas que não são x86-64.
+ * A versão utilizada é escolhida em tempo de execução, conforme as instruções suportadas pelo processador.
+ * As operações são feitas na mesma ordem e com os mesmos arredondamentos da versão escalar (sem FMA),
+ * logo todas as versões produzem resultados idênticos.
+ */
+
+/**
+ * @brief Conjuntos de instruções para os quais há uma versão dos núcleos.
+ *
+ */
+
+enum class ConjuntoInstrucoes
+{
+    ESCALAR,
+    SSE2,
+    AVX2,
+    AVX512
+};
+
+/**
+ * @brief Realiza destino[k] = destino[k] - multiplicador * origem[k] para k de 0 até n - 1.
+ *
+ * @param destino O vetor a ser atualizado
+ * @param origem O vetor multiplicado
+ * @param multiplicador O multiplicador da origem
+ * @param n O número de elementos
+ */
+
+void subtraiMultiplo(double *destino, const double *origem, double multiplicador, int n);
+
+/**
+ * @brief Divide cada um dos n elementos do vetor pelo divisor.
+ *
+ * @param v O vetor a ser dividido
+ * @param divisor O divisor
+ * @param n O número de elementos
+ */
+
+void divideVetor(double *v, double divisor, int n);
+
+/**
+ * @brief Procura o menor elemento do vetor. Em caso de empate, retorna o último índice, assim como a busca com <= da versão escalar.
+ *
+ * @param v O vetor
+ * @param n O número de elementos, que deve ser positivo
+ * @return int O índice do menor elemento
+ */
+
+int indiceMenor(const double *v, int n);
+
+/**
+ * @brief Realiza o teste da razão: procura o índice i com coluna[i] > 0 que minimiza b[i] / coluna[i]. Em caso de empate, retorna o último.
+ *
+ * @param b O vetor de soluções das restrições
+ * @param coluna A coluna do pivô
+ * @param n O número de elementos
+ * @return int O índice encontrado, 0 se nenhuma razão é menor que o maior double, ou -1 se não há coeficiente positivo na coluna.
+ */
+
+int indiceMenorRazao(const double *b, const double *coluna, int n);
+
+/**
+ * @brief Força a utilização de um conjunto de instruções. Útil para comparação de desempenho. Se o processador não o suporta, nada é alterado.
+ *
+ * @param conjunto O conjunto de instruções desejado
+ * @return true Se o conjunto passou a ser utilizado
+ * @return false Caso o processador não o suporte
+ */
+
+bool selecionaConjuntoInstrucoes(ConjuntoInstrucoes conjunto);
+
+/**
+ * @brief Retorna o conjunto de instruções em uso pelos núcleos.
+ *
+ * @return ConjuntoInstrucoes O conjunto em uso
+ */
+
+ConjuntoInstrucoes retornaConjuntoInstrucoes();
+
+#endif